@@ -0,0 +1,240 @@
+#pragma once
+
+#include "concurrent-single-linked-list.h"
+#include "intrusive-single-linked-list.h"
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#if __cplusplus > 201703L
+#include <coroutine>
+
+/*
+ * Асинхронный канал между корутинами на основе ConcurrentSingleLinkedQueue.
+ * Push, PushBatch, TryPop и Close могут вызываться из любого числа потоков одновременно.
+ * co_await Pop() извлекает значение без ожидания, если оно есть, и приостанавливает корутину,
+ * если канал пуст. Приостановленные корутины ждут в интрузивном списке в порядке прихода:
+ * узлом списка служит сам объект ожидания в кадре корутины, поэтому ожидание не выделяет память.
+ *
+ * Push передаёт значение первой ожидающей корутине и отдаёт её планировщику. Пока корутина
+ * не приостановится снова, её нет в списке ожидания, и следующие Push не будят её повторно:
+ * если планировщик откладывает возобновление, серия Push приводит к одному возобновлению,
+ * а корутина забирает остальные значения без приостановки.
+ * PushBatch публикует все значения одной операцией и будит не больше корутин, чем вставил значений.
+ *
+ * После Close ожидающие корутины возобновляются, а Pop возвращает оставшиеся значения
+ * и затем std::nullopt. Вызывать Push после Close нельзя
+ */
+template <typename Type>
+class AsyncSingleLinkedChannel {
+public:
+    // Объект ожидания, который возвращает Pop. co_await возвращает std::optional<Type>
+    class PopAwaiter : public IntrusiveListHook<> {
+        friend class AsyncSingleLinkedChannel;
+
+        explicit PopAwaiter(AsyncSingleLinkedChannel& channel) noexcept
+            : channel_(&channel) {
+        }
+
+    public:
+        // Корутина не приостанавливается, если значение уже есть или канал закрыт
+        [[nodiscard]] bool await_ready() {
+            // Значения, вставленные до закрытия, видны после чтения closed_
+            const bool closed = channel_->IsClosed();
+            result_ = channel_->queue_.PopFront();
+            return result_.has_value() || closed;
+        }
+
+        // Возвращает false, если значение появилось, пока корутина вставала в очередь ожидания
+        bool await_suspend(std::coroutine_handle<> handle) {
+            return channel_->Suspend(*this, handle);
+        }
+
+        std::optional<Type> await_resume() noexcept(std::is_nothrow_move_constructible_v<Type>) {
+            return std::move(result_);
+        }
+
+    private:
+        AsyncSingleLinkedChannel* channel_;
+        std::coroutine_handle<> handle_;
+        std::optional<Type> result_;
+    };
+
+    using value_type = Type;
+    // Получает корутины, для которых появилось значение, и решает, где и когда их возобновить.
+    // Не должен выбрасывать исключения
+    using Scheduler = std::function<void(std::coroutine_handle<>)>;
+
+    // По умолчанию корутина возобновляется сразу в потоке, который передал ей значение
+    explicit AsyncSingleLinkedChannel(Scheduler scheduler = ResumeInline);
+
+    AsyncSingleLinkedChannel(const AsyncSingleLinkedChannel&) = delete;
+    AsyncSingleLinkedChannel& operator=(const AsyncSingleLinkedChannel&) = delete;
+
+    // Разрушать можно, только когда канал не ждёт ни одна корутина
+    ~AsyncSingleLinkedChannel();
+
+    // Вставляет элемент value в конец канала и будит не больше одной ожидающей корутины
+    void Push(const Type& value);
+
+    void Push(Type&& value);
+
+    template <typename... Args>
+    void Emplace(Args&&... args);
+
+    // Вставляет элементы диапазона [first, last) одной операцией и будит не больше корутин, чем вставлено элементов
+    template <typename It, typename = std::enable_if_t<std::is_convertible_v<
+                               typename std::iterator_traits<It>::iterator_category, std::input_iterator_tag>>>
+    void PushBatch(It first, It last);
+
+    // Извлекает первый элемент без ожидания. Возвращает std::nullopt, если канал пуст
+    [[nodiscard]] std::optional<Type> TryPop();
+
+    // Возвращает объект ожидания: co_await channel.Pop()
+    [[nodiscard]] PopAwaiter Pop() noexcept;
+
+    // Закрывает канал и возобновляет все ожидающие корутины
+    void Close();
+
+    [[nodiscard]] bool IsClosed() const noexcept;
+
+private:
+    using WaiterList = IntrusiveSingleLinkedList<PopAwaiter>;
+
+    static void ResumeInline(std::coroutine_handle<> handle) {
+        handle.resume();
+    }
+
+    // Ставит awaiter в конец очереди ожидания, если канал всё ещё пуст и не закрыт
+    bool Suspend(PopAwaiter& awaiter, std::coroutine_handle<> handle);
+
+    // Передаёт значения не более чем count первым ожидающим корутинам и отдаёт их планировщику.
+    // После закрытия будит корутины и без значения
+    void WakeWaiters(size_t count);
+
+    ConcurrentSingleLinkedQueue<Type> queue_;
+    // Число корутин в очереди ожидания и вставающих в неё. Позволяет Push не захватывать мьютекс,
+    // когда никто не ждёт
+    std::atomic<size_t> waiting_count_ = 0;
+    std::atomic<bool> closed_ = false;
+    std::mutex waiters_mutex_;
+    WaiterList waiters_;
+    // Последний элемент очереди ожидания либо before_begin, если очередь пуста
+    typename WaiterList::ConstIterator last_waiter_ = waiters_.cbefore_begin();
+    Scheduler scheduler_;
+};
+
+template <typename Type>
+AsyncSingleLinkedChannel<Type>::AsyncSingleLinkedChannel(Scheduler scheduler)
+    : scheduler_(std::move(scheduler)) {
+}
+
+template <typename Type>
+AsyncSingleLinkedChannel<Type>::~AsyncSingleLinkedChannel() {
+    assert(waiters_.IsEmpty());
+}
+
+template <typename Type>
+void AsyncSingleLinkedChannel<Type>::Push(const Type& value) {
+    Emplace(value);
+}
+
+template <typename Type>
+void AsyncSingleLinkedChannel<Type>::Push(Type&& value) {
+    Emplace(std::move(value));
+}
+
+template <typename Type>
+template <typename... Args>
+void AsyncSingleLinkedChannel<Type>::Emplace(Args&&... args) {
+    assert(!IsClosed());
+    queue_.EmplaceBack(std::forward<Args>(args)...);
+    WakeWaiters(1);
+}
+
+template <typename Type>
+template <typename It, typename>
+void AsyncSingleLinkedChannel<Type>::PushBatch(It first, It last) {
+    assert(!IsClosed());
+    WakeWaiters(queue_.PushBackChain(first, last));
+}
+
+template <typename Type>
+std::optional<Type> AsyncSingleLinkedChannel<Type>::TryPop() {
+    return queue_.PopFront();
+}
+
+template <typename Type>
+typename AsyncSingleLinkedChannel<Type>::PopAwaiter AsyncSingleLinkedChannel<Type>::Pop() noexcept {
+    return PopAwaiter(*this);
+}
+
+template <typename Type>
+void AsyncSingleLinkedChannel<Type>::Close() {
+    closed_.store(true);
+    WakeWaiters(std::numeric_limits<size_t>::max());
+}
+
+template <typename Type>
+bool AsyncSingleLinkedChannel<Type>::IsClosed() const noexcept {
+    return closed_.load();
+}
+
+template <typename Type>
+bool AsyncSingleLinkedChannel<Type>::Suspend(PopAwaiter& awaiter, std::coroutine_handle<> handle) {
+    std::lock_guard lock(waiters_mutex_);
+    // Счётчик увеличивается до повторной проверки очереди: Push публикует значение до чтения счётчика,
+    // поэтому значение либо увидит эта проверка, либо Push увидит ожидающую корутину
+    waiting_count_.fetch_add(1);
+    const bool closed = IsClosed();
+    awaiter.result_ = queue_.PopFront();
+    if (awaiter.result_.has_value() || closed) {
+        waiting_count_.fetch_sub(1);
+        return false;
+    }
+    awaiter.handle_ = handle;
+    last_waiter_ = waiters_.InsertAfter(last_waiter_, awaiter);
+    // После освобождения мьютекса корутину может возобновить другой поток
+    return true;
+}
+
+template <typename Type>
+void AsyncSingleLinkedChannel<Type>::WakeWaiters(size_t count) {
+    if (count == 0 || waiting_count_.load() == 0) {
+        return;
+    }
+    WaiterList woken;
+    {
+        std::lock_guard lock(waiters_mutex_);
+        auto woken_last = woken.cbefore_begin();
+        for (; count > 0 && !waiters_.IsEmpty(); --count) {
+            PopAwaiter& waiter = waiters_.Front();
+            waiter.result_ = queue_.PopFront();
+            // Значение могла забрать корутина, не вставшая в очередь ожидания
+            if (!waiter.result_.has_value() && !IsClosed()) {
+                break;
+            }
+            waiters_.PopFront();
+            waiting_count_.fetch_sub(1);
+            woken_last = woken.InsertAfter(woken_last, waiter);
+        }
+        if (waiters_.IsEmpty()) {
+            last_waiter_ = waiters_.cbefore_begin();
+        }
+    }
+    // Планировщик вызывается без мьютекса: возобновлённая корутина может снова ждать этот канал
+    while (!woken.IsEmpty()) {
+        const std::coroutine_handle<> handle = woken.Front().handle_;
+        woken.PopFront();
+        scheduler_(handle);
+    }
+}
+#endif
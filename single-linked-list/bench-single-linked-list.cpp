@@ -0,0 +1,853 @@
+// Сравнительные замеры SingleLinkedList, std::forward_list и std::vector на основе Google Benchmark
+
+#include "single-linked-list.h"
+#include "node-pool.h"
+#include "node-arena.h"
+#include "unrolled-single-linked-list.h"
+#include "compact-single-linked-list.h"
+#include "persistent-single-linked-list.h"
+#include "small-single-linked-list.h"
+#include "immutable-single-linked-list.h"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstdio>
+#include <cstdint>
+#include <forward_list>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Структура размером 256 байт без нетривиальных конструкторов
+struct Pod256 {
+    std::int64_t key = 0;
+    std::array<char, 248> payload{};
+};
+
+bool operator==(const Pod256& lhs, const Pod256& rhs) {
+    return lhs.key == rhs.key;
+}
+
+bool operator<(const Pod256& lhs, const Pod256& rhs) {
+    return lhs.key < rhs.key;
+}
+
+template <typename Type>
+Type MakeValue(std::int64_t i);
+
+template <>
+int MakeValue<int>(std::int64_t i) {
+    return static_cast<int>(i);
+}
+
+// Строки длиннее буфера малых строк, чтобы каждая копия выделяла память
+template <>
+std::string MakeValue<std::string>(std::int64_t i) {
+    return std::string(24, 'x') + std::to_string(i);
+}
+
+template <>
+Pod256 MakeValue<Pod256>(std::int64_t i) {
+    Pod256 value;
+    value.key = i;
+    return value;
+}
+
+std::int64_t Weight(int value) {
+    return value;
+}
+
+std::int64_t Weight(const std::string& value) {
+    return static_cast<std::int64_t>(value.size());
+}
+
+std::int64_t Weight(const Pod256& value) {
+    return value.key;
+}
+
+template <typename Container>
+constexpr bool IS_VECTOR = false;
+
+template <typename Type>
+constexpr bool IS_VECTOR<std::vector<Type>> = true;
+
+template <typename Container>
+constexpr bool IS_FORWARD_LIST = false;
+
+template <typename Type>
+constexpr bool IS_FORWARD_LIST<std::forward_list<Type>> = true;
+
+// Вставка в начало. Для std::vector используется ближайший аналог - вставка в конец
+template <typename Container, typename Value>
+void PushFront(Container& container, Value&& value) {
+    if constexpr (IS_VECTOR<Container>) {
+        container.push_back(std::forward<Value>(value));
+    } else if constexpr (IS_FORWARD_LIST<Container>) {
+        container.push_front(std::forward<Value>(value));
+    } else {
+        container.PushFront(std::forward<Value>(value));
+    }
+}
+
+// Удаление первого элемента. Для std::vector - удаление последнего
+template <typename Container>
+void PopFront(Container& container) {
+    if constexpr (IS_VECTOR<Container>) {
+        container.pop_back();
+    } else if constexpr (IS_FORWARD_LIST<Container>) {
+        container.pop_front();
+    } else {
+        container.PopFront();
+    }
+}
+
+// Вставка после первого элемента
+template <typename Container, typename Value>
+void InsertAfterFirst(Container& container, Value&& value) {
+    if constexpr (IS_VECTOR<Container>) {
+        container.insert(container.begin() + 1, std::forward<Value>(value));
+    } else if constexpr (IS_FORWARD_LIST<Container>) {
+        container.insert_after(container.cbegin(), std::forward<Value>(value));
+    } else {
+        container.InsertAfter(container.cbegin(), std::forward<Value>(value));
+    }
+}
+
+// Удаление элемента, следующего за первым
+template <typename Container>
+void EraseAfterFirst(Container& container) {
+    if constexpr (IS_VECTOR<Container>) {
+        container.erase(container.begin() + 1);
+    } else if constexpr (IS_FORWARD_LIST<Container>) {
+        container.erase_after(container.cbegin());
+    } else {
+        container.EraseAfter(container.cbegin());
+    }
+}
+
+template <typename Container>
+Container MakeContainer(std::int64_t size) {
+    using Type = typename Container::value_type;
+    std::vector<Type> values;
+    values.reserve(static_cast<size_t>(size));
+    for (std::int64_t i = 0; i < size; ++i) {
+        values.push_back(MakeValue<Type>(i));
+    }
+    return Container(values.begin(), values.end());
+}
+
+template <typename Container>
+void BM_PushFront(benchmark::State& state) {
+    using Type = typename Container::value_type;
+    const Type value = MakeValue<Type>(42);
+    for (auto _ : state) {
+        Container container;
+        for (std::int64_t i = 0; i < state.range(0); ++i) {
+            PushFront(container, value);
+        }
+        benchmark::DoNotOptimize(container);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Container>
+void BM_InsertAfter(benchmark::State& state) {
+    using Type = typename Container::value_type;
+    const Type value = MakeValue<Type>(42);
+    for (auto _ : state) {
+        Container container = MakeContainer<Container>(1);
+        for (std::int64_t i = 0; i < state.range(0); ++i) {
+            InsertAfterFirst(container, value);
+        }
+        benchmark::DoNotOptimize(container);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Container>
+void BM_EraseAfter(benchmark::State& state) {
+    for (auto _ : state) {
+        state.PauseTiming();
+        Container container = MakeContainer<Container>(state.range(0) + 1);
+        state.ResumeTiming();
+        for (std::int64_t i = 0; i < state.range(0); ++i) {
+            EraseAfterFirst(container);
+        }
+        benchmark::DoNotOptimize(container);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Container>
+void BM_PopFront(benchmark::State& state) {
+    for (auto _ : state) {
+        state.PauseTiming();
+        Container container = MakeContainer<Container>(state.range(0));
+        state.ResumeTiming();
+        for (std::int64_t i = 0; i < state.range(0); ++i) {
+            PopFront(container);
+        }
+        benchmark::DoNotOptimize(container);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Type>
+using ReservedList = SingleLinkedList<Type, std::allocator<Type>, NoTailTracking, NoListStatistics, NodeReserve>;
+
+// Повторное заполнение списка после Clear. ReservedList берёт узлы из запаса, остальные - у аллокатора
+template <typename Container>
+void BM_RefillAfterClear(benchmark::State& state) {
+    using Type = typename Container::value_type;
+    const Type value = MakeValue<Type>(42);
+    Container container;
+    if constexpr (std::is_same_v<Container, ReservedList<Type>>) {
+        container.Reserve(static_cast<size_t>(state.range(0)));
+    }
+    for (auto _ : state) {
+        for (std::int64_t i = 0; i < state.range(0); ++i) {
+            container.PushFront(value);
+        }
+        container.Clear();
+        benchmark::DoNotOptimize(container);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Вставка пачками по 1000 элементов против BM_PushFront
+template <typename Container>
+void BM_PushFrontBatch(benchmark::State& state) {
+    using Type = typename Container::value_type;
+    const std::vector<Type> batch(1000, MakeValue<Type>(42));
+    for (auto _ : state) {
+        Container container;
+        for (std::int64_t i = 0; i < state.range(0); i += 1000) {
+            container.PushFrontBatch(batch.begin(), batch.end());
+        }
+        benchmark::DoNotOptimize(container);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Type>
+using FingerprintList
+    = SingleLinkedList<Type, std::allocator<Type>, NoTailTracking, NoListStatistics, NoNodeReserve, IncrementalFingerprint>;
+
+// Хеширование 1000 ключей длины range(0), как при поиске в unordered_set.
+// FingerprintList возвращает поддерживаемый отпечаток, остальные списки обходят элементы
+template <typename Container>
+void BM_HashKeys(benchmark::State& state) {
+    std::vector<Container> keys(1000);
+    for (size_t i = 0; i < keys.size(); ++i) {
+        for (std::int64_t j = 0; j < state.range(0); ++j) {
+            keys[i].PushFront(static_cast<int>(i + j));
+        }
+    }
+    for (auto _ : state) {
+        size_t combined = 0;
+        for (const Container& key : keys) {
+            combined ^= std::hash<Container>{}(key);
+        }
+        benchmark::DoNotOptimize(combined);
+    }
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+template <typename Type>
+using IndexedList
+    = SingleLinkedList<Type, std::allocator<Type>, NoTailTracking, NoListStatistics, NoNodeReserve, NoFingerprint, SkipIndex>;
+
+// Вставка в отсортированный список из range(0) элементов с сохранением порядка и удаление вставленного.
+// Позиция вставки ищется обходом от начала списка
+template <typename Container>
+void BM_SortedInsertLinear(benchmark::State& state) {
+    Container list;
+    for (std::int64_t i = state.range(0); i > 0; --i) {
+        list.PushFront(static_cast<int>(2 * i));
+    }
+    int value = 1;
+    for (auto _ : state) {
+        auto pos = list.before_begin();
+        for (auto next = std::next(pos); next != list.end() && *next < value; ++next) {
+            pos = next;
+        }
+        list.EraseAfter(list.InsertAfter(pos, value));
+        value = (value + 2 * 7919) % static_cast<int>(2 * state.range(0));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// То же, что BM_SortedInsertLinear, но позицию вставки находит индекс SkipIndex
+template <typename Container>
+void BM_SortedInsertIndexed(benchmark::State& state) {
+    Container list;
+    for (std::int64_t i = state.range(0); i > 0; --i) {
+        list.PushFront(static_cast<int>(2 * i));
+    }
+    int value = 1;
+    for (auto _ : state) {
+        auto pos = list.LowerBoundBefore(value);
+        list.EraseAfter(list.InsertAfter(pos, value));
+        value = (value + 2 * 7919) % static_cast<int>(2 * state.range(0));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Доступ к элементу по номеру: обход от начала списка против At
+template <typename Container>
+void BM_PositionalAccess(benchmark::State& state) {
+    Container list;
+    for (std::int64_t i = 0; i < state.range(0); ++i) {
+        list.PushFront(static_cast<int>(i));
+    }
+    const size_t size = list.GetSize();
+    size_t index = 0;
+    for (auto _ : state) {
+        if constexpr (std::is_same_v<Container, IndexedList<int>>) {
+            benchmark::DoNotOptimize(list.At(index));
+        } else {
+            benchmark::DoNotOptimize(*std::next(list.begin(), static_cast<std::ptrdiff_t>(index)));
+        }
+        index = (index + 7919) % size;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+/*
+ * Случайные чередования InsertAfter, EraseAfter, PushFront, PopFront, swap и копирования
+ * на списке из range(0) элементов. std::forward_list служит оракулом: размер сверяется
+ * после каждой операции, содержимое - в конце замера. Скорость включает работу оракула
+ */
+template <typename Container>
+void BM_FuzzAgainstForwardList(benchmark::State& state) {
+    using Oracle = std::forward_list<int>;
+    Container list = MakeContainer<Container>(state.range(0));
+    Oracle oracle(list.begin(), list.end());
+    Container other;
+    Oracle other_oracle;
+    size_t size = list.GetSize();
+    size_t other_size = 0;
+    // Позиция, с которой работают InsertAfter и EraseAfter
+    auto pos = list.cbefore_begin();
+    auto oracle_pos = oracle.cbefore_begin();
+    std::mt19937 random(42);
+    for (auto _ : state) {
+        const unsigned operation = random() % 1000;
+        const int value = static_cast<int>(random() % 1000);
+        if (operation < 250) {
+            pos = list.InsertAfter(pos, value);
+            oracle_pos = oracle.insert_after(oracle_pos, value);
+            ++size;
+        } else if (operation < 500) {
+            if (std::next(pos) != list.cend()) {
+                list.EraseAfter(pos);
+                oracle.erase_after(oracle_pos);
+                --size;
+            }
+        } else if (operation < 600) {
+            list.PushFront(value);
+            oracle.push_front(value);
+            ++size;
+        } else if (operation < 750) {
+            if (size > 0) {
+                if (pos == list.cbegin()) {
+                    pos = list.cbefore_begin();
+                    oracle_pos = oracle.cbefore_begin();
+                }
+                list.PopFront();
+                oracle.pop_front();
+                --size;
+            }
+        } else if (operation < 990) {
+            for (unsigned i = random() % 16; i > 0 && std::next(pos) != list.cend(); --i) {
+                ++pos;
+                ++oracle_pos;
+            }
+            if (random() % 64 == 0) {
+                pos = list.cbefore_begin();
+                oracle_pos = oracle.cbefore_begin();
+            }
+        } else if (operation < 999) {
+            list.swap(other);
+            oracle.swap(other_oracle);
+            std::swap(size, other_size);
+            pos = list.cbefore_begin();
+            oracle_pos = oracle.cbefore_begin();
+        } else if (random() % (size / 1000 + 1) == 0) {
+            // Чем длиннее список, тем реже он копируется, чтобы доля копирования в замере не зависела от N
+            other = list;
+            other_oracle = oracle;
+            other_size = size;
+        }
+        if (list.GetSize() != size || other.GetSize() != other_size) {
+            state.SkipWithError("GetSize() differs from std::forward_list");
+            break;
+        }
+    }
+    if (!std::equal(list.begin(), list.end(), oracle.begin(), oracle.end())
+        || !std::equal(other.begin(), other.end(), other_oracle.begin(), other_oracle.end())) {
+        state.SkipWithError("contents differ from std::forward_list");
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Разворот перестановкой указателей узлов
+template <typename Container>
+void BM_Reverse(benchmark::State& state) {
+    Container list = MakeContainer<Container>(state.range(0));
+    for (auto _ : state) {
+        list.Reverse();
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Разворот через построение нового списка при помощи PushFront, как до появления Reverse
+template <typename Container>
+void BM_ReverseRebuild(benchmark::State& state) {
+    Container list = MakeContainer<Container>(state.range(0));
+    for (auto _ : state) {
+        Container reversed;
+        for (const auto& value : list) {
+            reversed.PushFront(value);
+        }
+        list.swap(reversed);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Разрезание списка на 8 частей и обратная склейка, как при раздаче частей работы потокам
+template <typename Container>
+void BM_SplitEvery(benchmark::State& state) {
+    Container list = MakeContainer<Container>(state.range(0));
+    const size_t part_size = std::max<size_t>(1, list.GetSize() / 8);
+    for (auto _ : state) {
+        auto parts = list.SplitEvery(part_size);
+        for (auto& part : parts) {
+            list.SpliceBack(part);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Заполнение списка из range(0) элементов через PushFront и опустошение через PopFront без поиска.
+// Для IndexedList время на элемент не должно расти с N: индекс обновляется за амортизированное O(1)
+template <typename Container>
+void BM_PushPopScaling(benchmark::State& state) {
+    for (auto _ : state) {
+        Container list;
+        for (std::int64_t i = 0; i < state.range(0); ++i) {
+            list.PushFront(static_cast<int>(i));
+        }
+        while (!list.IsEmpty()) {
+            list.PopFront();
+        }
+        benchmark::DoNotOptimize(list);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Удаление пачками по 1000 элементов против BM_PopFront
+template <typename Container>
+void BM_PopFrontN(benchmark::State& state) {
+    using Type = typename Container::value_type;
+    std::vector<Type> out(1000);
+    for (auto _ : state) {
+        state.PauseTiming();
+        Container container = MakeContainer<Container>(state.range(0));
+        state.ResumeTiming();
+        while (!container.IsEmpty()) {
+            container.PopFrontN(out.size(), out.begin());
+        }
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Очистка контейнера. Для std-контейнеров используется clear()
+template <typename Container>
+void Clear(Container& container) {
+    if constexpr (IS_VECTOR<Container> || IS_FORWARD_LIST<Container>) {
+        container.clear();
+    } else {
+        container.Clear();
+    }
+}
+
+template <typename Container>
+void BM_Clear(benchmark::State& state) {
+    for (auto _ : state) {
+        state.PauseTiming();
+        Container container = MakeContainer<Container>(state.range(0));
+        state.ResumeTiming();
+        Clear(container);
+        benchmark::DoNotOptimize(container);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Каждый поток заполняет и очищает свой список: потоки соревнуются только за общий аллокатор
+template <typename Container>
+void BM_PushFrontClear(benchmark::State& state) {
+    Container container;
+    for (auto _ : state) {
+        for (int64_t i = 0; i < state.range(0); ++i) {
+            PushFront(container, static_cast<int>(i));
+        }
+        Clear(container);
+        benchmark::DoNotOptimize(container);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Container>
+void BM_CopyConstruct(benchmark::State& state) {
+    const Container source = MakeContainer<Container>(state.range(0));
+    for (auto _ : state) {
+        Container copy(source);
+        benchmark::DoNotOptimize(copy);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Container>
+void BM_CopyAssign(benchmark::State& state) {
+    const Container source = MakeContainer<Container>(state.range(0));
+    Container target = MakeContainer<Container>(state.range(0));
+    for (auto _ : state) {
+        target = source;
+        benchmark::DoNotOptimize(target);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Container>
+void BM_Equal(benchmark::State& state) {
+    const Container lhs = MakeContainer<Container>(state.range(0));
+    const Container rhs = MakeContainer<Container>(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(lhs == rhs);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Container>
+void BM_Less(benchmark::State& state) {
+    const Container lhs = MakeContainer<Container>(state.range(0));
+    const Container rhs = MakeContainer<Container>(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(lhs < rhs);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Равные списки - худший случай для <=: раньше он обходил их дважды
+template <typename Container>
+void BM_LessEqual(benchmark::State& state) {
+    const Container lhs = MakeContainer<Container>(state.range(0));
+    const Container rhs = MakeContainer<Container>(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(lhs <= rhs);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Container>
+void BM_Iterate(benchmark::State& state) {
+    const Container container = MakeContainer<Container>(state.range(0));
+    for (auto _ : state) {
+        std::int64_t sum = 0;
+        for (const auto& value : container) {
+            sum += Weight(value);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Создание и разрушение множества коротких списков по 4 элемента
+template <typename Container>
+void BM_ShortLists(benchmark::State& state) {
+    using Type = typename Container::value_type;
+    const Type value = MakeValue<Type>(42);
+    for (auto _ : state) {
+        for (std::int64_t i = 0; i < state.range(0); ++i) {
+            Container container;
+            for (int j = 0; j < 4; ++j) {
+                PushFront(container, value);
+            }
+            benchmark::DoNotOptimize(container);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Обход SingleLinkedList::ForEach с предвыборкой следующего узла
+template <typename Container>
+void BM_ForEach(benchmark::State& state) {
+    const Container container = MakeContainer<Container>(state.range(0));
+    for (auto _ : state) {
+        std::int64_t sum = 0;
+        container.ForEach([&sum](const auto& value) {
+            sum += Weight(value);
+        });
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Container>
+void BM_ForEachChunked(benchmark::State& state) {
+    const Container container = MakeContainer<Container>(state.range(0));
+    for (auto _ : state) {
+        std::int64_t sum = 0;
+        container.ForEachChunked([&sum](const auto* items, size_t count) {
+            for (size_t i = 0; i < count; ++i) {
+                sum += Weight(*items[i]);
+            }
+        });
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Параллельная свёртка; второй аргумент - число потоков
+template <typename Container>
+void BM_ParallelReduce(benchmark::State& state) {
+    const Container container = MakeContainer<Container>(state.range(0));
+    const auto thread_count = static_cast<size_t>(state.range(1));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(container.ParallelReduce(std::int64_t{0}, std::plus<>{}, thread_count));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Список из перемешанных значений: отсортированный вход сортируется слишком быстро
+template <typename Container>
+Container MakeShuffledContainer(std::int64_t size) {
+    using Type = typename Container::value_type;
+    Container container;
+    std::uint64_t state = 1;
+    for (std::int64_t i = 0; i < size; ++i) {
+        state = state * 6364136223846793005u + 1442695040888963407u;
+        container.PushFront(MakeValue<Type>(static_cast<std::int64_t>(state >> 40)));
+    }
+    return container;
+}
+
+// Второй аргумент - число потоков; 1 соответствует обычной Sort
+template <typename Container>
+void BM_ParallelSort(benchmark::State& state) {
+    const auto thread_count = static_cast<size_t>(state.range(1));
+    for (auto _ : state) {
+        state.PauseTiming();
+        Container container = MakeShuffledContainer<Container>(state.range(0));
+        state.ResumeTiming();
+        if (thread_count == 1) {
+            container.Sort();
+        } else {
+            container.ParallelSort(std::less<>{}, thread_count);
+        }
+        benchmark::DoNotOptimize(container);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Container>
+void BM_Serialize(benchmark::State& state) {
+    const Container container = MakeContainer<Container>(state.range(0));
+    std::vector<unsigned char> buffer(container.GetSerializedSize());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(container.Serialize(buffer.data(), buffer.size()));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Container>
+void BM_Deserialize(benchmark::State& state) {
+    const Container source = MakeContainer<Container>(state.range(0));
+    std::vector<unsigned char> buffer(source.GetSerializedSize());
+    source.Serialize(buffer.data(), buffer.size());
+    for (auto _ : state) {
+        Container container = Container::Deserialize(buffer.data(), buffer.size());
+        benchmark::DoNotOptimize(container);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Создаёт файл списка из size элементов и возвращает его путь
+std::string MakePersistentFile(std::int64_t size) {
+    const std::string path = "/tmp/bench-persistent-list-" + std::to_string(size) + ".bin";
+    std::remove(path.c_str());
+    PersistentSingleLinkedList<std::int64_t> list(path);
+    list.Reserve(static_cast<size_t>(size));
+    auto pos = list.cbefore_begin();
+    for (std::int64_t i = 0; i < size; ++i) {
+        pos = list.InsertAfter(pos, i);
+    }
+    return path;
+}
+
+// Открытие сохранённого списка не зависит от его длины, в отличие от BM_Deserialize
+void BM_PersistentOpen(benchmark::State& state) {
+    const std::string path = MakePersistentFile(state.range(0));
+    for (auto _ : state) {
+        const PersistentSingleLinkedList<std::int64_t> list(path, PersistentOpenMode::ReadOnly);
+        benchmark::DoNotOptimize(list.Front());
+    }
+    std::remove(path.c_str());
+}
+
+void BM_PersistentIterate(benchmark::State& state) {
+    const std::string path = MakePersistentFile(state.range(0));
+    const PersistentSingleLinkedList<std::int64_t> list(path, PersistentOpenMode::ReadOnly);
+    for (auto _ : state) {
+        std::int64_t sum = 0;
+        for (const std::int64_t value : list) {
+            sum += value;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    std::remove(path.c_str());
+}
+
+void ParallelSizes(benchmark::internal::Benchmark* benchmark) {
+    benchmark->ArgsProduct({{100'000, 1'000'000, 10'000'000}, {1, 2, 4, 8}})->UseRealTime();
+}
+
+constexpr std::int64_t MIN_SIZE = 10;
+constexpr std::int64_t MAX_SIZE = 10'000'000;
+// Вставка и удаление в середине std::vector выполняются за O(N), поэтому размеры ограничены
+constexpr std::int64_t MAX_VECTOR_MIDDLE_SIZE = 100'000;
+
+void Sizes(benchmark::internal::Benchmark* benchmark) {
+    benchmark->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+}
+
+void VectorMiddleSizes(benchmark::internal::Benchmark* benchmark) {
+    benchmark->RangeMultiplier(10)->Range(MIN_SIZE, MAX_VECTOR_MIDDLE_SIZE);
+}
+
+template <typename Type>
+using PooledList = SingleLinkedList<Type, PoolAllocator<Type>>;
+
+template <typename Type>
+using ArenaList = SingleLinkedList<Type, ArenaAllocator<Type>>;
+
+}  // namespace
+
+#define BENCHMARK_LIST_OPERATIONS(Container)                        \
+    BENCHMARK_TEMPLATE(BM_PushFront, Container)->Apply(Sizes);     \
+    BENCHMARK_TEMPLATE(BM_InsertAfter, Container)->Apply(Sizes);   \
+    BENCHMARK_TEMPLATE(BM_EraseAfter, Container)->Apply(Sizes);    \
+    BENCHMARK_TEMPLATE(BM_PopFront, Container)->Apply(Sizes);      \
+    BENCHMARK_TEMPLATE(BM_CopyConstruct, Container)->Apply(Sizes); \
+    BENCHMARK_TEMPLATE(BM_CopyAssign, Container)->Apply(Sizes);    \
+    BENCHMARK_TEMPLATE(BM_Equal, Container)->Apply(Sizes);         \
+    BENCHMARK_TEMPLATE(BM_Less, Container)->Apply(Sizes);          \
+    BENCHMARK_TEMPLATE(BM_LessEqual, Container)->Apply(Sizes);     \
+    BENCHMARK_TEMPLATE(BM_Iterate, Container)->Apply(Sizes)
+
+#define BENCHMARK_VECTOR_OPERATIONS(Container)                                \
+    BENCHMARK_TEMPLATE(BM_PushFront, Container)->Apply(Sizes);               \
+    BENCHMARK_TEMPLATE(BM_InsertAfter, Container)->Apply(VectorMiddleSizes); \
+    BENCHMARK_TEMPLATE(BM_EraseAfter, Container)->Apply(VectorMiddleSizes);  \
+    BENCHMARK_TEMPLATE(BM_PopFront, Container)->Apply(Sizes);                \
+    BENCHMARK_TEMPLATE(BM_CopyConstruct, Container)->Apply(Sizes);           \
+    BENCHMARK_TEMPLATE(BM_CopyAssign, Container)->Apply(Sizes);              \
+    BENCHMARK_TEMPLATE(BM_Equal, Container)->Apply(Sizes);                   \
+    BENCHMARK_TEMPLATE(BM_Less, Container)->Apply(Sizes);                    \
+    BENCHMARK_TEMPLATE(BM_LessEqual, Container)->Apply(Sizes);               \
+    BENCHMARK_TEMPLATE(BM_Iterate, Container)->Apply(Sizes)
+
+// Очистка: ArenaList<int> освобождает арену целиком, остальные списки обходят узлы
+BENCHMARK_TEMPLATE(BM_Clear, SingleLinkedList<int>)->Apply(Sizes);
+BENCHMARK_TEMPLATE(BM_Clear, PooledList<int>)->Apply(Sizes);
+BENCHMARK_TEMPLATE(BM_Clear, ArenaList<int>)->Apply(Sizes);
+BENCHMARK_TEMPLATE(BM_Clear, std::forward_list<int>)->Apply(Sizes);
+
+BENCHMARK_TEMPLATE(BM_ForEach, SingleLinkedList<int>)->Apply(Sizes);
+BENCHMARK_TEMPLATE(BM_ForEachChunked, SingleLinkedList<int>)->Apply(Sizes);
+BENCHMARK_TEMPLATE(BM_ForEach, SingleLinkedList<Pod256>)->Apply(Sizes);
+BENCHMARK_TEMPLATE(BM_ForEachChunked, SingleLinkedList<Pod256>)->Apply(Sizes);
+BENCHMARK_TEMPLATE(BM_ShortLists, SingleLinkedList<int>)->Arg(1000);
+BENCHMARK_TEMPLATE(BM_ShortLists, PooledList<int>)->Arg(1000);
+BENCHMARK_TEMPLATE(BM_ShortLists, SmallSingleLinkedList<int>)->Arg(1000);
+BENCHMARK_TEMPLATE(BM_ShortLists, std::forward_list<int>)->Arg(1000);
+BENCHMARK_TEMPLATE(BM_ShortLists, SmallSingleLinkedList<std::string>)->Arg(1000);
+BENCHMARK_TEMPLATE(BM_ShortLists, SingleLinkedList<std::string>)->Arg(1000);
+
+BENCHMARK_TEMPLATE(BM_Serialize, SingleLinkedList<int>)->Apply(Sizes);
+BENCHMARK_TEMPLATE(BM_Deserialize, SingleLinkedList<int>)->Apply(Sizes);
+BENCHMARK_TEMPLATE(BM_Deserialize, PooledList<int>)->Apply(Sizes);
+
+BENCHMARK_TEMPLATE(BM_RefillAfterClear, ReservedList<int>)->Apply(Sizes);
+BENCHMARK_TEMPLATE(BM_RefillAfterClear, SingleLinkedList<int>)->Apply(Sizes);
+BENCHMARK_TEMPLATE(BM_RefillAfterClear, PooledList<int>)->Apply(Sizes);
+
+BENCHMARK_TEMPLATE(BM_PushFrontClear, SingleLinkedList<int>)->Arg(1000)->ThreadRange(1, 4)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_PushFrontClear, PooledList<int>)->Arg(1000)->ThreadRange(1, 4)->UseRealTime();
+
+BENCHMARK_TEMPLATE(BM_HashKeys, SingleLinkedList<int>)->Arg(8)->Arg(64);
+BENCHMARK_TEMPLATE(BM_HashKeys, FingerprintList<int>)->Arg(8)->Arg(64);
+
+BENCHMARK_TEMPLATE(BM_SortedInsertLinear, SingleLinkedList<int>)->Arg(1000)->Arg(100000);
+BENCHMARK_TEMPLATE(BM_SortedInsertIndexed, IndexedList<int>)->Arg(1000)->Arg(100000);
+BENCHMARK_TEMPLATE(BM_PositionalAccess, SingleLinkedList<int>)->Arg(1000)->Arg(100000);
+BENCHMARK_TEMPLATE(BM_PositionalAccess, IndexedList<int>)->Arg(1000)->Arg(100000);
+BENCHMARK_TEMPLATE(BM_PushPopScaling, SingleLinkedList<int>)->Arg(10000)->Arg(100000)->Arg(1000000);
+BENCHMARK_TEMPLATE(BM_PushPopScaling, IndexedList<int>)->Arg(10000)->Arg(100000)->Arg(1000000);
+
+BENCHMARK_TEMPLATE(BM_FuzzAgainstForwardList, SingleLinkedList<int>)->Arg(1000)->Arg(1000000);
+BENCHMARK_TEMPLATE(BM_FuzzAgainstForwardList, PooledList<int>)->Arg(1000)->Arg(1000000);
+
+BENCHMARK_TEMPLATE(BM_Reverse, SingleLinkedList<int>)->Apply(Sizes);
+BENCHMARK_TEMPLATE(BM_ReverseRebuild, SingleLinkedList<int>)->Apply(Sizes);
+BENCHMARK_TEMPLATE(BM_Reverse, SingleLinkedList<std::string>)->Apply(Sizes);
+BENCHMARK_TEMPLATE(BM_ReverseRebuild, SingleLinkedList<std::string>)->Apply(Sizes);
+BENCHMARK_TEMPLATE(BM_SplitEvery, SingleLinkedList<int, std::allocator<int>, TailTracking>)->Apply(Sizes);
+
+BENCHMARK_TEMPLATE(BM_PushFrontBatch, SingleLinkedList<int>)->Apply(Sizes);
+BENCHMARK_TEMPLATE(BM_PushFrontBatch, PooledList<int>)->Apply(Sizes);
+BENCHMARK_TEMPLATE(BM_PopFrontN, SingleLinkedList<int>)->Apply(Sizes);
+BENCHMARK_TEMPLATE(BM_PopFrontN, PooledList<int>)->Apply(Sizes);
+
+BENCHMARK(BM_PersistentOpen)->Apply(Sizes);
+BENCHMARK(BM_PersistentIterate)->Apply(Sizes);
+
+// Копирование неизменяемого списка не зависит от его длины
+BENCHMARK_TEMPLATE(BM_CopyConstruct, ImmutableSingleLinkedList<int>)->Apply(Sizes);
+BENCHMARK_TEMPLATE(BM_CopyConstruct, ImmutableSingleLinkedList<std::string>)->Apply(Sizes);
+BENCHMARK_TEMPLATE(BM_PopFront, ImmutableSingleLinkedList<int>)->Apply(Sizes);
+
+BENCHMARK_TEMPLATE(BM_ParallelReduce, SingleLinkedList<int>)->Apply(ParallelSizes);
+BENCHMARK_TEMPLATE(BM_ParallelSort, SingleLinkedList<int>)->Apply(ParallelSizes);
+
+BENCHMARK_LIST_OPERATIONS(SingleLinkedList<int>);
+BENCHMARK_LIST_OPERATIONS(PooledList<int>);
+BENCHMARK_LIST_OPERATIONS(UnrolledSingleLinkedList<int>);
+BENCHMARK_LIST_OPERATIONS(CompactSingleLinkedList<int>);
+BENCHMARK_LIST_OPERATIONS(SmallSingleLinkedList<int>);
+BENCHMARK_LIST_OPERATIONS(std::forward_list<int>);
+BENCHMARK_VECTOR_OPERATIONS(std::vector<int>);
+
+BENCHMARK_LIST_OPERATIONS(SingleLinkedList<std::string>);
+BENCHMARK_LIST_OPERATIONS(PooledList<std::string>);
+BENCHMARK_LIST_OPERATIONS(UnrolledSingleLinkedList<std::string>);
+BENCHMARK_LIST_OPERATIONS(CompactSingleLinkedList<std::string>);
+BENCHMARK_LIST_OPERATIONS(std::forward_list<std::string>);
+BENCHMARK_VECTOR_OPERATIONS(std::vector<std::string>);
+
+BENCHMARK_LIST_OPERATIONS(SingleLinkedList<Pod256>);
+BENCHMARK_LIST_OPERATIONS(PooledList<Pod256>);
+BENCHMARK_LIST_OPERATIONS(UnrolledSingleLinkedList<Pod256>);
+BENCHMARK_LIST_OPERATIONS(CompactSingleLinkedList<Pod256>);
+BENCHMARK_LIST_OPERATIONS(std::forward_list<Pod256>);
+BENCHMARK_VECTOR_OPERATIONS(std::vector<Pod256>);
+
+BENCHMARK_MAIN();
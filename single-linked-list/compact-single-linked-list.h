@@ -0,0 +1,593 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#if __cplusplus > 201703L
+#include <compare>
+#endif
+
+/*
+ * Компактный односвязный список: узлы хранятся в одном растущем массиве,
+ * а связи между ними - индексы типа Index (по умолчанию 32-битные) вместо указателей.
+ * Освобождённые ячейки образуют список свободных ячеек внутри того же массива.
+ * Для SingleLinkedList<int32_t> узел занимает 16 байт плюс служебные данные кучи,
+ * здесь - 8 байт, а соседние узлы чаще попадают в одну кеш-линию.
+ * Интерфейс повторяет SingleLinkedList. В отличие от него, вставка, при которой
+ * массив растёт, делает недействительными все итераторы, как у std::vector
+ */
+template <typename Type, typename Index = std::uint32_t>
+class CompactSingleLinkedList {
+    static_assert(std::is_unsigned_v<Index>, "Index must be an unsigned integer type");
+
+    // Индекс, обозначающий отсутствие следующего узла
+    static constexpr Index NIL = std::numeric_limits<Index>::max();
+    // Ячейка 0 - фиктивный узел, используется для вставки "перед первым элементом"
+    static constexpr Index HEAD = 0;
+
+    // Ячейка массива. Значение хранится только в ячейках, входящих в список
+    struct Slot {
+        Type* Get() noexcept {
+            return std::launder(reinterpret_cast<Type*>(storage));
+        }
+
+        Index next = NIL;
+        alignas(Type) unsigned char storage[sizeof(Type)];
+    };
+
+    // Шаблон класса «Базовый Итератор».
+    // Итератор хранит адрес массива ячеек и индекс ячейки
+    // ValueType — совпадает с Type (для Iterator) либо с const Type (для ConstIterator)
+    template <typename ValueType>
+    class BasicIterator {
+        friend class CompactSingleLinkedList;
+
+        BasicIterator(Slot* slots, Index index) noexcept
+            : slots_(slots)
+            , index_(index) {
+        }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = ValueType*;
+        using reference = ValueType&;
+
+        BasicIterator() = default;
+
+        // Конвертирующий конструктор/конструктор копирования
+        BasicIterator(const BasicIterator<Type>& other) noexcept
+            : slots_(other.slots_)
+            , index_(other.index_) {
+        }
+
+        BasicIterator& operator=(const BasicIterator& rhs) = default;
+
+        [[nodiscard]] bool operator==(const BasicIterator<const Type>& rhs) const noexcept {
+            return index_ == rhs.index_;
+        }
+
+        [[nodiscard]] bool operator!=(const BasicIterator<const Type>& rhs) const noexcept {
+            return !(index_ == rhs.index_);
+        }
+
+        [[nodiscard]] bool operator==(const BasicIterator<Type>& rhs) const noexcept {
+            return index_ == rhs.index_;
+        }
+
+        [[nodiscard]] bool operator!=(const BasicIterator<Type>& rhs) const noexcept {
+            return !(index_ == rhs.index_);
+        }
+
+        // Инкремент итератора, не указывающего на существующий элемент списка, приводит к неопределённому поведению
+        BasicIterator& operator++() noexcept {
+            if (index_ != NIL) {
+                index_ = slots_[index_].next;
+            }
+            return *this;
+        }
+
+        BasicIterator operator++(int) noexcept {
+            auto old_it(*this);
+            ++(*this);
+            return old_it;
+        }
+
+        [[nodiscard]] reference operator*() const noexcept {
+            assert(index_ != NIL && index_ != HEAD);
+            return *slots_[index_].Get();
+        }
+
+        [[nodiscard]] pointer operator->() const noexcept {
+            assert(index_ != NIL && index_ != HEAD);
+            return slots_[index_].Get();
+        }
+
+    private:
+        Slot* slots_ = nullptr;
+        Index index_ = NIL;
+    };
+
+public:
+    using value_type = Type;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+
+    using Iterator = BasicIterator<Type>;
+    using ConstIterator = BasicIterator<const Type>;
+
+    // Наибольшее количество элементов списка: один индекс занят фиктивным узлом, другой - NIL
+    static constexpr size_t MAX_SIZE = std::min<size_t>(NIL - 1, std::numeric_limits<size_t>::max() / sizeof(Slot));
+
+    [[nodiscard]] Iterator begin() noexcept {
+        return Iterator{slots_, slots_[HEAD].next};
+    }
+
+    [[nodiscard]] Iterator end() noexcept {
+        return Iterator{slots_, NIL};
+    }
+
+    [[nodiscard]] ConstIterator begin() const noexcept {
+        return cbegin();
+    }
+
+    [[nodiscard]] ConstIterator end() const noexcept {
+        return cend();
+    }
+
+    [[nodiscard]] ConstIterator cbegin() const noexcept {
+        return ConstIterator{slots_, slots_[HEAD].next};
+    }
+
+    [[nodiscard]] ConstIterator cend() const noexcept {
+        return ConstIterator{slots_, NIL};
+    }
+
+    // Возвращает итератор, указывающий на позицию перед первым элементом списка.
+    // Разыменовывать этот итератор нельзя - попытка разыменования приведёт к неопределённому поведению
+    [[nodiscard]] Iterator before_begin() noexcept {
+        return Iterator{slots_, HEAD};
+    }
+
+    [[nodiscard]] ConstIterator cbefore_begin() const noexcept {
+        return ConstIterator{slots_, HEAD};
+    }
+
+    [[nodiscard]] ConstIterator before_begin() const noexcept {
+        return cbefore_begin();
+    }
+
+    CompactSingleLinkedList() = default;
+
+    CompactSingleLinkedList(std::initializer_list<Type> values);
+
+    template <typename It, typename = std::enable_if_t<std::is_convertible_v<
+                               typename std::iterator_traits<It>::iterator_category, std::input_iterator_tag>>>
+    CompactSingleLinkedList(It first, It last);
+
+    // Копия размещает элементы в массиве подряд, в порядке следования в списке
+    CompactSingleLinkedList(const CompactSingleLinkedList& other);
+
+    CompactSingleLinkedList(CompactSingleLinkedList&& other) noexcept;
+
+    CompactSingleLinkedList& operator=(const CompactSingleLinkedList& rhs);
+
+    CompactSingleLinkedList& operator=(CompactSingleLinkedList&& rhs) noexcept;
+
+    ~CompactSingleLinkedList();
+
+    // Обменивает содержимое списков за время O(1)
+    void swap(CompactSingleLinkedList& other) noexcept;
+
+    /*
+     * Вставляет элемент value после элемента, на который указывает pos, за амортизированное время O(1).
+     * Возвращает итератор на вставленный элемент
+     * Если при создании элемента или росте массива будет выброшено исключение,
+     * список останется в прежнем состоянии
+     */
+    Iterator InsertAfter(ConstIterator pos, const Type& value);
+
+    Iterator InsertAfter(ConstIterator pos, Type&& value);
+
+    template <typename... Args>
+    Iterator EmplaceAfter(ConstIterator pos, Args&&... args);
+
+    /*
+     * Удаляет элемент, следующий за pos, за время O(1). Ячейка попадает в список свободных ячеек.
+     * Возвращает итератор на элемент, следующий за удалённым
+     */
+    Iterator EraseAfter(ConstIterator pos) noexcept;
+
+    void PushFront(const Type& value);
+
+    void PushFront(Type&& value);
+
+    template <typename... Args>
+    Type& EmplaceFront(Args&&... args);
+
+    void PopFront() noexcept;
+
+    // Готовит массив к хранению capacity элементов без перевыделения памяти
+    void Reserve(size_t capacity);
+
+    // Очищает список за время O(N). Память массива сохраняется для повторного использования
+    void Clear() noexcept;
+
+    [[nodiscard]] size_t GetSize() const noexcept;
+
+    [[nodiscard]] bool IsEmpty() const noexcept;
+
+    // Количество элементов, которое список может хранить без перевыделения массива
+    [[nodiscard]] size_t GetCapacity() const noexcept;
+
+    /*
+     * Лексикографически сравнивает список с other за один проход.
+     * Возвращает отрицательное число, если список меньше other, ноль, если списки равны,
+     * и положительное число, если список больше. Элементы сравниваются только оператором <
+     */
+    [[nodiscard]] int CompareTo(const CompactSingleLinkedList& other) const;
+
+private:
+    // Фиктивный узел пустого списка, у которого ещё нет массива. Никогда не изменяется
+    static inline Slot empty_head_ = {};
+
+    // Конструирует значение в свободной ячейке и присоединяет её к списку после ячейки prev
+    template <typename... Args>
+    Iterator LinkNewSlot(Index prev, Args&&... args);
+
+    // Возвращает свободную ячейку, при необходимости увеличивая массив
+    Index AcquireSlot();
+
+    // Переносит массив в новый буфер из capacity ячеек
+    void Reallocate(size_t capacity);
+
+    // Разрушает значения и освобождает массив
+    void Destroy() noexcept;
+
+    template <typename It>
+    void MakeList(It first, It last);
+
+    bool HasStorage() const noexcept {
+        return slots_ != &empty_head_;
+    }
+
+    Slot* slots_ = &empty_head_;
+    // Количество ячеек массива, включая фиктивный узел
+    size_t capacity_ = 0;
+    // Ячейки с индексами не меньше used_ ни разу не использовались
+    size_t used_ = 1;
+    Index free_ = NIL;
+    size_t size_ = 0;
+};
+
+template <typename Type, typename Index>
+CompactSingleLinkedList<Type, Index>::CompactSingleLinkedList(std::initializer_list<Type> values) {
+    MakeList(values.begin(), values.end());
+}
+
+template <typename Type, typename Index>
+template <typename It, typename>
+CompactSingleLinkedList<Type, Index>::CompactSingleLinkedList(It first, It last) {
+    MakeList(first, last);
+}
+
+template <typename Type, typename Index>
+CompactSingleLinkedList<Type, Index>::CompactSingleLinkedList(const CompactSingleLinkedList& other) {
+    if (other.size_ > 0) {
+        Reserve(other.size_);
+    }
+    MakeList(other.begin(), other.end());
+}
+
+template <typename Type, typename Index>
+CompactSingleLinkedList<Type, Index>::CompactSingleLinkedList(CompactSingleLinkedList&& other) noexcept {
+    swap(other);
+}
+
+template <typename Type, typename Index>
+CompactSingleLinkedList<Type, Index>& CompactSingleLinkedList<Type, Index>::operator=(
+    const CompactSingleLinkedList& rhs) {
+    if (this != &rhs) {
+        auto rhs_copy(rhs);
+        swap(rhs_copy);
+    }
+    return *this;
+}
+
+template <typename Type, typename Index>
+CompactSingleLinkedList<Type, Index>& CompactSingleLinkedList<Type, Index>::operator=(
+    CompactSingleLinkedList&& rhs) noexcept {
+    if (this != &rhs) {
+        Destroy();
+        swap(rhs);
+    }
+    return *this;
+}
+
+template <typename Type, typename Index>
+CompactSingleLinkedList<Type, Index>::~CompactSingleLinkedList() {
+    Destroy();
+}
+
+template <typename Type, typename Index>
+void CompactSingleLinkedList<Type, Index>::swap(CompactSingleLinkedList& other) noexcept {
+    std::swap(slots_, other.slots_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(used_, other.used_);
+    std::swap(free_, other.free_);
+    std::swap(size_, other.size_);
+}
+
+template <typename Type, typename Index>
+typename CompactSingleLinkedList<Type, Index>::Iterator CompactSingleLinkedList<Type, Index>::InsertAfter(
+    ConstIterator pos, const Type& value) {
+    return EmplaceAfter(pos, value);
+}
+
+template <typename Type, typename Index>
+typename CompactSingleLinkedList<Type, Index>::Iterator CompactSingleLinkedList<Type, Index>::InsertAfter(
+    ConstIterator pos, Type&& value) {
+    return EmplaceAfter(pos, std::move(value));
+}
+
+template <typename Type, typename Index>
+template <typename... Args>
+typename CompactSingleLinkedList<Type, Index>::Iterator CompactSingleLinkedList<Type, Index>::EmplaceAfter(
+    ConstIterator pos, Args&&... args) {
+    assert(pos.index_ != NIL);
+    if (free_ == NIL && used_ >= capacity_) {
+        // Массив будет расти, а args может ссылаться на элемент этого же списка,
+        // поэтому значение создаётся до переноса элементов
+        Type value(std::forward<Args>(args)...);
+        return LinkNewSlot(pos.index_, std::move(value));
+    }
+    return LinkNewSlot(pos.index_, std::forward<Args>(args)...);
+}
+
+template <typename Type, typename Index>
+template <typename... Args>
+typename CompactSingleLinkedList<Type, Index>::Iterator CompactSingleLinkedList<Type, Index>::LinkNewSlot(
+    Index prev, Args&&... args) {
+    const Index index = AcquireSlot();
+    try {
+        ::new (slots_[index].storage) Type(std::forward<Args>(args)...);
+    } catch (...) {
+        // Возвращаем ячейку в список свободных ячеек
+        slots_[index].next = free_;
+        free_ = index;
+        throw;
+    }
+    slots_[index].next = slots_[prev].next;
+    slots_[prev].next = index;
+    ++size_;
+    return Iterator{slots_, index};
+}
+
+template <typename Type, typename Index>
+typename CompactSingleLinkedList<Type, Index>::Iterator CompactSingleLinkedList<Type, Index>::EraseAfter(
+    ConstIterator pos) noexcept {
+    assert(pos.index_ != NIL && slots_[pos.index_].next != NIL);
+    const Index erased = slots_[pos.index_].next;
+    slots_[pos.index_].next = slots_[erased].next;
+    slots_[erased].Get()->~Type();
+    slots_[erased].next = free_;
+    free_ = erased;
+    --size_;
+    return Iterator{slots_, slots_[pos.index_].next};
+}
+
+template <typename Type, typename Index>
+void CompactSingleLinkedList<Type, Index>::PushFront(const Type& value) {
+    EmplaceFront(value);
+}
+
+template <typename Type, typename Index>
+void CompactSingleLinkedList<Type, Index>::PushFront(Type&& value) {
+    EmplaceFront(std::move(value));
+}
+
+template <typename Type, typename Index>
+template <typename... Args>
+Type& CompactSingleLinkedList<Type, Index>::EmplaceFront(Args&&... args) {
+    return *EmplaceAfter(cbefore_begin(), std::forward<Args>(args)...);
+}
+
+template <typename Type, typename Index>
+void CompactSingleLinkedList<Type, Index>::PopFront() noexcept {
+    assert(size_ > 0);
+    EraseAfter(cbefore_begin());
+}
+
+template <typename Type, typename Index>
+void CompactSingleLinkedList<Type, Index>::Reserve(size_t capacity) {
+    if (capacity > MAX_SIZE) {
+        throw std::length_error("CompactSingleLinkedList capacity exceeds the index range");
+    }
+    if (capacity + 1 > capacity_) {
+        Reallocate(capacity + 1);
+    }
+}
+
+template <typename Type, typename Index>
+void CompactSingleLinkedList<Type, Index>::Clear() noexcept {
+    if (!HasStorage()) {
+        return;
+    }
+    if constexpr (!std::is_trivially_destructible_v<Type>) {
+        for (Index i = slots_[HEAD].next; i != NIL; i = slots_[i].next) {
+            slots_[i].Get()->~Type();
+        }
+    }
+    slots_[HEAD].next = NIL;
+    used_ = 1;
+    free_ = NIL;
+    size_ = 0;
+}
+
+template <typename Type, typename Index>
+size_t CompactSingleLinkedList<Type, Index>::GetSize() const noexcept {
+    return size_;
+}
+
+template <typename Type, typename Index>
+bool CompactSingleLinkedList<Type, Index>::IsEmpty() const noexcept {
+    return size_ == 0;
+}
+
+template <typename Type, typename Index>
+size_t CompactSingleLinkedList<Type, Index>::GetCapacity() const noexcept {
+    return capacity_ == 0 ? 0 : capacity_ - 1;
+}
+
+template <typename Type, typename Index>
+int CompactSingleLinkedList<Type, Index>::CompareTo(const CompactSingleLinkedList& other) const {
+    auto lhs = begin();
+    auto rhs = other.begin();
+    for (; lhs != end() && rhs != other.end(); ++lhs, ++rhs) {
+        if (*lhs < *rhs) {
+            return -1;
+        }
+        if (*rhs < *lhs) {
+            return 1;
+        }
+    }
+    if (lhs == end()) {
+        return rhs == other.end() ? 0 : -1;
+    }
+    return 1;
+}
+
+template <typename Type, typename Index>
+Index CompactSingleLinkedList<Type, Index>::AcquireSlot() {
+    if (free_ != NIL) {
+        return std::exchange(free_, slots_[free_].next);
+    }
+    if (used_ >= capacity_) {
+        const size_t elements = capacity_ == 0 ? 0 : capacity_ - 1;
+        if (elements == MAX_SIZE) {
+            throw std::length_error("CompactSingleLinkedList size exceeds the index range");
+        }
+        // Массив растёт вдвое, но не больше, чем позволяет тип индекса
+        Reallocate(std::min(std::max<size_t>(2 * capacity_, 16), MAX_SIZE + 1));
+    }
+    return static_cast<Index>(used_++);
+}
+
+template <typename Type, typename Index>
+void CompactSingleLinkedList<Type, Index>::Reallocate(size_t capacity) {
+    assert(capacity > capacity_);
+    std::allocator<Slot> allocator;
+    Slot* slots = allocator.allocate(capacity);
+    for (size_t i = 0; i < capacity; ++i) {
+        ::new (slots + i) Slot{};
+    }
+    if (HasStorage()) {
+        // Переносим связи всех ячеек и значения ячеек, входящих в список
+        for (size_t i = 0; i < used_; ++i) {
+            slots[i].next = slots_[i].next;
+        }
+        Index moved = slots_[HEAD].next;
+        try {
+            for (; moved != NIL; moved = slots_[moved].next) {
+                ::new (slots[moved].storage) Type(std::move_if_noexcept(*slots_[moved].Get()));
+            }
+        } catch (...) {
+            for (Index i = slots_[HEAD].next; i != moved; i = slots_[i].next) {
+                slots[i].Get()->~Type();
+            }
+            allocator.deallocate(slots, capacity);
+            throw;
+        }
+        if constexpr (!std::is_trivially_destructible_v<Type>) {
+            for (Index i = slots_[HEAD].next; i != NIL; i = slots_[i].next) {
+                slots_[i].Get()->~Type();
+            }
+        }
+        allocator.deallocate(slots_, capacity_);
+    }
+    slots_ = slots;
+    capacity_ = capacity;
+}
+
+template <typename Type, typename Index>
+void CompactSingleLinkedList<Type, Index>::Destroy() noexcept {
+    if (!HasStorage()) {
+        return;
+    }
+    Clear();
+    std::allocator<Slot>{}.deallocate(slots_, capacity_);
+    slots_ = &empty_head_;
+    capacity_ = 0;
+}
+
+template <typename Type, typename Index>
+template <typename It>
+void CompactSingleLinkedList<Type, Index>::MakeList(It first, It last) {
+    assert(size_ == 0);
+    Index tail = HEAD;
+    try {
+        for (; first != last; ++first) {
+            tail = EmplaceAfter(ConstIterator{slots_, tail}, *first).index_;
+        }
+    } catch (...) {
+        Destroy();
+        throw;
+    }
+}
+
+template <typename Type, typename Index>
+void swap(CompactSingleLinkedList<Type, Index>& lhs, CompactSingleLinkedList<Type, Index>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+template <typename Type, typename Index>
+bool operator==(const CompactSingleLinkedList<Type, Index>& lhs, const CompactSingleLinkedList<Type, Index>& rhs) {
+    // Списки разной длины не равны, и обходить их не нужно
+    return lhs.GetSize() == rhs.GetSize() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <typename Type, typename Index>
+bool operator!=(const CompactSingleLinkedList<Type, Index>& lhs, const CompactSingleLinkedList<Type, Index>& rhs) {
+    return !(lhs == rhs);
+}
+
+template <typename Type, typename Index>
+bool operator<(const CompactSingleLinkedList<Type, Index>& lhs, const CompactSingleLinkedList<Type, Index>& rhs) {
+    return lhs.CompareTo(rhs) < 0;
+}
+
+template <typename Type, typename Index>
+bool operator>(const CompactSingleLinkedList<Type, Index>& lhs, const CompactSingleLinkedList<Type, Index>& rhs) {
+    return lhs.CompareTo(rhs) > 0;
+}
+
+template <typename Type, typename Index>
+bool operator<=(const CompactSingleLinkedList<Type, Index>& lhs, const CompactSingleLinkedList<Type, Index>& rhs) {
+    return lhs.CompareTo(rhs) <= 0;
+}
+
+template <typename Type, typename Index>
+bool operator>=(const CompactSingleLinkedList<Type, Index>& lhs, const CompactSingleLinkedList<Type, Index>& rhs) {
+    return lhs.CompareTo(rhs) >= 0;
+}
+
+#if __cplusplus > 201703L
+template <typename Type, typename Index>
+std::weak_ordering operator<=>(const CompactSingleLinkedList<Type, Index>& lhs, const CompactSingleLinkedList<Type, Index>& rhs) {
+    const int result = lhs.CompareTo(rhs);
+    if (result < 0) {
+        return std::weak_ordering::less;
+    }
+    return result == 0 ? std::weak_ordering::equivalent : std::weak_ordering::greater;
+}
+#endif
@@ -0,0 +1,363 @@
+#pragma once
+
+#include "hazard-pointers.h"
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+/*
+ * Lock-free стек Трайбера на узлах односвязного списка.
+ * PushFront и PopFront могут вызываться из любого числа потоков одновременно.
+ * Узлы, извлечённые из стека, освобождаются через указатели опасности, что защищает
+ * от обращения к освобождённой памяти и от проблемы ABA
+ */
+template <typename Type>
+class ConcurrentSingleLinkedList {
+    // Узел списка. Поле next_node записывается только до публикации узла
+    struct Node : HazardRetired {
+        template <typename... Args>
+        explicit Node(std::in_place_t, Args&&... args)
+            : value(std::forward<Args>(args)...) {
+        }
+        Type value;
+        Node* next_node = nullptr;
+    };
+
+public:
+    using value_type = Type;
+
+    ConcurrentSingleLinkedList() = default;
+    ConcurrentSingleLinkedList(const ConcurrentSingleLinkedList&) = delete;
+    ConcurrentSingleLinkedList& operator=(const ConcurrentSingleLinkedList&) = delete;
+
+    // Разрушает оставшиеся узлы. Вызывать можно, только когда другие потоки не обращаются к списку
+    ~ConcurrentSingleLinkedList();
+
+    // Вставляет элемент value в начало списка
+    void PushFront(const Type& value);
+
+    void PushFront(Type&& value);
+
+    template <typename... Args>
+    void EmplaceFront(Args&&... args);
+
+    /*
+     * Вставляет элементы диапазона [first, last) в начало списка, сохраняя их порядок.
+     * Цепочка узлов строится заранее и публикуется одной операцией compare_exchange,
+     * поэтому другие потоки видят либо все элементы цепочки, либо ни одного
+     */
+    template <typename It, typename = std::enable_if_t<std::is_convertible_v<
+                               typename std::iterator_traits<It>::iterator_category, std::input_iterator_tag>>>
+    void PushFrontChain(It first, It last);
+
+    // Извлекает первый элемент списка. Возвращает std::nullopt, если список пуст
+    [[nodiscard]] std::optional<Type> PopFront();
+
+    // Сообщает, был ли список пуст в момент вызова
+    [[nodiscard]] bool IsEmpty() const noexcept;
+
+private:
+    // Публикует цепочку [first, last] в начале списка
+    void PublishChain(Node* first, Node* last) noexcept;
+
+    static void DeleteNode(HazardRetired* node) noexcept {
+        delete static_cast<Node*>(node);
+    }
+
+    std::atomic<Node*> head_{nullptr};
+};
+
+/*
+ * Lock-free очередь Майкла-Скотта на узлах односвязного списка.
+ * PushBack и PopFront могут вызываться из любого числа потоков одновременно.
+ * Очередь всегда содержит фиктивный первый узел; извлечённые узлы освобождаются
+ * через указатели опасности
+ */
+template <typename Type>
+class ConcurrentSingleLinkedQueue {
+    // Узел очереди. Фиктивный узел не содержит значения
+    struct Node : HazardRetired {
+        Node() = default;
+        template <typename... Args>
+        explicit Node(std::in_place_t, Args&&... args)
+            : value(std::in_place, std::forward<Args>(args)...) {
+        }
+        std::optional<Type> value;
+        std::atomic<Node*> next_node{nullptr};
+    };
+
+public:
+    using value_type = Type;
+
+    ConcurrentSingleLinkedQueue();
+    ConcurrentSingleLinkedQueue(const ConcurrentSingleLinkedQueue&) = delete;
+    ConcurrentSingleLinkedQueue& operator=(const ConcurrentSingleLinkedQueue&) = delete;
+
+    // Разрушает оставшиеся узлы. Вызывать можно, только когда другие потоки не обращаются к очереди
+    ~ConcurrentSingleLinkedQueue();
+
+    // Вставляет элемент value в конец очереди
+    void PushBack(const Type& value);
+
+    void PushBack(Type&& value);
+
+    template <typename... Args>
+    void EmplaceBack(Args&&... args);
+
+    /*
+     * Вставляет элементы диапазона [first, last) в конец очереди, сохраняя их порядок.
+     * Цепочка узлов строится заранее и присоединяется одной операцией compare_exchange.
+     * Возвращает число вставленных элементов
+     */
+    template <typename It, typename = std::enable_if_t<std::is_convertible_v<
+                               typename std::iterator_traits<It>::iterator_category, std::input_iterator_tag>>>
+    size_t PushBackChain(It first, It last);
+
+    // Извлекает первый элемент очереди. Возвращает std::nullopt, если очередь пуста
+    [[nodiscard]] std::optional<Type> PopFront();
+
+    // Сообщает, была ли очередь пуста в момент вызова.
+    // При первом обращении потока к очереди захватывает для него указатель опасности,
+    // поэтому может выбросить исключение, если ячейки указателей опасности закончились
+    [[nodiscard]] bool IsEmpty() const;
+
+private:
+    // Присоединяет цепочку [first, last] к концу очереди, защищая хвост указателем опасности hazard.
+    // Указатель опасности захватывается до выделения узлов, чтобы не выбрасывать исключение при публикации
+    void PublishChain(HazardPointerDomain::Slot& hazard, Node* first, Node* last) noexcept;
+
+    static void DeleteNode(HazardRetired* node) noexcept {
+        delete static_cast<Node*>(node);
+    }
+
+    // Фиктивный узел, за которым следует первый элемент очереди
+    std::atomic<Node*> head_;
+    std::atomic<Node*> tail_;
+};
+
+template <typename Type>
+ConcurrentSingleLinkedList<Type>::~ConcurrentSingleLinkedList() {
+    Node* node = head_.load();
+    while (node != nullptr) {
+        Node* next = node->next_node;
+        delete node;
+        node = next;
+    }
+}
+
+template <typename Type>
+void ConcurrentSingleLinkedList<Type>::PushFront(const Type& value) {
+    EmplaceFront(value);
+}
+
+template <typename Type>
+void ConcurrentSingleLinkedList<Type>::PushFront(Type&& value) {
+    EmplaceFront(std::move(value));
+}
+
+template <typename Type>
+template <typename... Args>
+void ConcurrentSingleLinkedList<Type>::EmplaceFront(Args&&... args) {
+    Node* node = new Node(std::in_place, std::forward<Args>(args)...);
+    PublishChain(node, node);
+}
+
+template <typename Type>
+template <typename It, typename>
+void ConcurrentSingleLinkedList<Type>::PushFrontChain(It first, It last) {
+    Node* chain_first = nullptr;
+    Node* chain_last = nullptr;
+    try {
+        for (; first != last; ++first) {
+            Node* node = new Node(std::in_place, *first);
+            if (chain_last) {
+                chain_last->next_node = node;
+            } else {
+                chain_first = node;
+            }
+            chain_last = node;
+        }
+    } catch (...) {
+        while (chain_first) {
+            delete std::exchange(chain_first, chain_first->next_node);
+        }
+        throw;
+    }
+    if (chain_first) {
+        PublishChain(chain_first, chain_last);
+    }
+}
+
+template <typename Type>
+void ConcurrentSingleLinkedList<Type>::PublishChain(Node* first, Node* last) noexcept {
+    Node* head = head_.load(std::memory_order_relaxed);
+    do {
+        last->next_node = head;
+    } while (!head_.compare_exchange_weak(head, first, std::memory_order_release, std::memory_order_relaxed));
+}
+
+template <typename Type>
+std::optional<Type> ConcurrentSingleLinkedList<Type>::PopFront() {
+    HazardPointerDomain::Slot& hazard = ThreadHazardPointer<0>();
+    Node* head = nullptr;
+    while (true) {
+        head = ProtectHazard(hazard, head_);
+        if (head == nullptr) {
+            return std::nullopt;
+        }
+        // Пока узел защищён, он не может быть освобождён и повторно вставлен в список,
+        // поэтому успешный compare_exchange гарантирует, что next_node актуален
+        if (head_.compare_exchange_strong(head, head->next_node)) {
+            break;
+        }
+    }
+    hazard.store(nullptr);
+
+    std::optional<Type> result(std::move(head->value));
+    head->deleter = &DeleteNode;
+    HazardPointerDomain::Instance().Retire(head);
+    return result;
+}
+
+template <typename Type>
+bool ConcurrentSingleLinkedList<Type>::IsEmpty() const noexcept {
+    return head_.load() == nullptr;
+}
+
+template <typename Type>
+ConcurrentSingleLinkedQueue<Type>::ConcurrentSingleLinkedQueue() {
+    Node* dummy = new Node();
+    head_.store(dummy);
+    tail_.store(dummy);
+}
+
+template <typename Type>
+ConcurrentSingleLinkedQueue<Type>::~ConcurrentSingleLinkedQueue() {
+    Node* node = head_.load();
+    while (node != nullptr) {
+        Node* next = node->next_node.load();
+        delete node;
+        node = next;
+    }
+}
+
+template <typename Type>
+void ConcurrentSingleLinkedQueue<Type>::PushBack(const Type& value) {
+    EmplaceBack(value);
+}
+
+template <typename Type>
+void ConcurrentSingleLinkedQueue<Type>::PushBack(Type&& value) {
+    EmplaceBack(std::move(value));
+}
+
+template <typename Type>
+template <typename... Args>
+void ConcurrentSingleLinkedQueue<Type>::EmplaceBack(Args&&... args) {
+    HazardPointerDomain::Slot& hazard = ThreadHazardPointer<0>();
+    Node* node = new Node(std::in_place, std::forward<Args>(args)...);
+    PublishChain(hazard, node, node);
+}
+
+template <typename Type>
+template <typename It, typename>
+size_t ConcurrentSingleLinkedQueue<Type>::PushBackChain(It first, It last) {
+    HazardPointerDomain::Slot& hazard = ThreadHazardPointer<0>();
+    Node* chain_first = nullptr;
+    Node* chain_last = nullptr;
+    size_t count = 0;
+    try {
+        for (; first != last; ++first) {
+            Node* node = new Node(std::in_place, *first);
+            if (chain_last) {
+                chain_last->next_node.store(node, std::memory_order_relaxed);
+            } else {
+                chain_first = node;
+            }
+            chain_last = node;
+            ++count;
+        }
+    } catch (...) {
+        while (chain_first) {
+            delete std::exchange(chain_first, chain_first->next_node.load(std::memory_order_relaxed));
+        }
+        throw;
+    }
+    if (chain_first) {
+        PublishChain(hazard, chain_first, chain_last);
+    }
+    return count;
+}
+
+template <typename Type>
+void ConcurrentSingleLinkedQueue<Type>::PublishChain(HazardPointerDomain::Slot& hazard, Node* first,
+                                                     Node* last) noexcept {
+    while (true) {
+        Node* tail = ProtectHazard(hazard, tail_);
+        Node* next = tail->next_node.load();
+        if (tail != tail_.load()) {
+            continue;
+        }
+        if (next != nullptr) {
+            // Хвост отстал: помогаем другому потоку передвинуть его
+            tail_.compare_exchange_weak(tail, next);
+            continue;
+        }
+        Node* expected = nullptr;
+        if (tail->next_node.compare_exchange_weak(expected, first)) {
+            // Если не удастся, хвост передвинет другой поток
+            tail_.compare_exchange_strong(tail, last);
+            break;
+        }
+    }
+    hazard.store(nullptr);
+}
+
+template <typename Type>
+std::optional<Type> ConcurrentSingleLinkedQueue<Type>::PopFront() {
+    HazardPointerDomain::Slot& head_hazard = ThreadHazardPointer<0>();
+    HazardPointerDomain::Slot& next_hazard = ThreadHazardPointer<1>();
+    while (true) {
+        Node* head = ProtectHazard(head_hazard, head_);
+        Node* tail = tail_.load();
+        Node* next = head->next_node.load();
+        next_hazard.store(static_cast<const HazardRetired*>(next));
+        if (head != head_.load()) {
+            continue;
+        }
+        if (next == nullptr) {
+            head_hazard.store(nullptr);
+            next_hazard.store(nullptr);
+            return std::nullopt;
+        }
+        if (head == tail) {
+            // Хвост отстал: помогаем другому потоку передвинуть его
+            tail_.compare_exchange_weak(tail, next);
+            continue;
+        }
+        if (head_.compare_exchange_strong(head, next)) {
+            // next стал фиктивным узлом. Его значение читает только поток, выполнивший обмен
+            std::optional<Type> result(std::move(next->value));
+            next->value.reset();
+            head_hazard.store(nullptr);
+            next_hazard.store(nullptr);
+            head->deleter = &DeleteNode;
+            HazardPointerDomain::Instance().Retire(head);
+            return result;
+        }
+    }
+}
+
+template <typename Type>
+bool ConcurrentSingleLinkedQueue<Type>::IsEmpty() const {
+    HazardPointerDomain::Slot& hazard = ThreadHazardPointer<0>();
+    Node* head = ProtectHazard(hazard, head_);
+    const bool empty = head->next_node.load() == nullptr;
+    hazard.store(nullptr);
+    return empty;
+}
@@ -0,0 +1,173 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+
+// Заголовок объекта, ожидающего освобождения. Встраивается в узлы lock-free контейнеров,
+// чтобы постановка узла в очередь на удаление не требовала выделения памяти
+struct HazardRetired {
+    HazardRetired* next_retired = nullptr;
+    void (*deleter)(HazardRetired*) = nullptr;
+};
+
+/*
+ * Указатели опасности (hazard pointers).
+ * Поток, читающий разделяемый узел, публикует его адрес в своей ячейке. Удалённые из контейнера
+ * узлы не освобождаются сразу, а помещаются в список ожидающих и освобождаются только тогда,
+ * когда ни одна ячейка на них не указывает. Это исключает обращение к освобождённой памяти
+ * и проблему ABA: адрес узла не может быть использован повторно, пока узел защищён
+ */
+class HazardPointerDomain {
+public:
+    // Максимальное количество одновременно занятых ячеек во всей программе
+    static constexpr size_t MAX_HAZARD_POINTERS = 256;
+
+    // Ячейка указателя опасности
+    using Slot = std::atomic<const void*>;
+
+    HazardPointerDomain() = default;
+    HazardPointerDomain(const HazardPointerDomain&) = delete;
+    HazardPointerDomain& operator=(const HazardPointerDomain&) = delete;
+
+    // Возвращает общий для всей программы домен.
+    // Домен намеренно не разрушается, чтобы потоки могли освобождать узлы при завершении программы
+    static HazardPointerDomain& Instance() {
+        static HazardPointerDomain* domain = new HazardPointerDomain();
+        return *domain;
+    }
+
+    // Захватывает свободную ячейку. Если свободных ячеек нет, выбрасывает std::runtime_error
+    Slot& AcquireSlot() {
+        for (Record& record : records_) {
+            bool expected = false;
+            if (!record.busy.load(std::memory_order_relaxed)
+                && record.busy.compare_exchange_strong(expected, true)) {
+                return record.pointer;
+            }
+        }
+        throw std::runtime_error("no free hazard pointer slots");
+    }
+
+    // Освобождает ячейку, захваченную AcquireSlot
+    void ReleaseSlot(Slot& slot) noexcept {
+        slot.store(nullptr);
+        for (Record& record : records_) {
+            if (&record.pointer == &slot) {
+                record.busy.store(false);
+                return;
+            }
+        }
+    }
+
+    // Помещает объект в список ожидающих освобождения.
+    // Когда список становится длинным, освобождает объекты, на которые не указывает ни одна ячейка
+    void Retire(HazardRetired* retired) noexcept {
+        Push(retired, retired);
+        if (retired_count_.fetch_add(1) + 1 >= RECLAIM_THRESHOLD) {
+            Reclaim();
+        }
+    }
+
+    // Освобождает все незащищённые объекты из списка ожидающих
+    void Reclaim() noexcept {
+        HazardRetired* retired = retired_.exchange(nullptr);
+        if (retired == nullptr) {
+            return;
+        }
+        size_t taken = 0;
+        for (HazardRetired* node = retired; node != nullptr; node = node->next_retired) {
+            ++taken;
+        }
+        retired_count_.fetch_sub(taken);
+
+        // Снимок всех опубликованных указателей
+        std::array<const void*, MAX_HAZARD_POINTERS> hazards{};
+        size_t hazard_count = 0;
+        for (const Record& record : records_) {
+            if (const void* pointer = record.pointer.load()) {
+                hazards[hazard_count++] = pointer;
+            }
+        }
+        std::sort(hazards.begin(), hazards.begin() + hazard_count);
+
+        // Защищённые объекты возвращаются в список ожидающих
+        HazardRetired* kept_first = nullptr;
+        HazardRetired* kept_last = nullptr;
+        size_t kept = 0;
+        while (retired != nullptr) {
+            HazardRetired* next = retired->next_retired;
+            if (std::binary_search(hazards.begin(), hazards.begin() + hazard_count,
+                                   static_cast<const void*>(retired))) {
+                retired->next_retired = kept_first;
+                kept_first = retired;
+                if (kept_last == nullptr) {
+                    kept_last = retired;
+                }
+                ++kept;
+            } else {
+                retired->deleter(retired);
+            }
+            retired = next;
+        }
+        if (kept_first != nullptr) {
+            Push(kept_first, kept_last);
+            retired_count_.fetch_add(kept);
+        }
+    }
+
+private:
+    static constexpr size_t RECLAIM_THRESHOLD = 2 * MAX_HAZARD_POINTERS;
+
+    struct Record {
+        std::atomic<bool> busy{false};
+        Slot pointer{nullptr};
+    };
+
+    // Добавляет цепочку [first, last] в начало списка ожидающих
+    void Push(HazardRetired* first, HazardRetired* last) noexcept {
+        HazardRetired* head = retired_.load();
+        do {
+            last->next_retired = head;
+        } while (!retired_.compare_exchange_weak(head, first));
+    }
+
+    std::array<Record, MAX_HAZARD_POINTERS> records_;
+    std::atomic<HazardRetired*> retired_{nullptr};
+    std::atomic<size_t> retired_count_{0};
+};
+
+// Возвращает ячейку указателя опасности текущего потока с номером Index.
+// Ячейка захватывается при первом обращении и освобождается при завершении потока
+template <size_t Index>
+HazardPointerDomain::Slot& ThreadHazardPointer() {
+    struct Owner {
+        Owner()
+            : slot(HazardPointerDomain::Instance().AcquireSlot()) {
+        }
+        ~Owner() {
+            HazardPointerDomain::Instance().ReleaseSlot(slot);
+        }
+        HazardPointerDomain::Slot& slot;
+    };
+    thread_local Owner owner;
+    return owner.slot;
+}
+
+// Публикует в ячейке slot значение source и возвращает его. Повторяет чтение, пока
+// опубликованный указатель не совпадёт с текущим значением source, после чего
+// узел гарантированно не будет освобождён до очистки ячейки.
+// Node должен быть наследником HazardRetired: в ячейке публикуется адрес этой базы
+template <typename Node>
+Node* ProtectHazard(HazardPointerDomain::Slot& slot, const std::atomic<Node*>& source) noexcept {
+    Node* pointer = source.load();
+    Node* published = nullptr;
+    do {
+        published = pointer;
+        slot.store(static_cast<const HazardRetired*>(published));
+        pointer = source.load();
+    } while (pointer != published);
+    return pointer;
+}
@@ -0,0 +1,386 @@
+#pragma once
+
+#include "single-linked-list.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+/*
+ * Неизменяемый односвязный список с разделяемыми хвостами.
+ * Узлы никогда не изменяются после создания и подсчитывают ссылки на себя,
+ * поэтому копирование списка выполняется за время O(1) и не копирует элементы,
+ * PushFront создаёт один узел, продолжением которого служит существующий список,
+ * а PopFront только переходит к следующему узлу. Элементы списка доступны только для чтения.
+ *
+ * Счётчики ссылок атомарны, поэтому копии одного списка можно использовать
+ * и разрушать в разных потоках. Сам объект списка, как и std::shared_ptr,
+ * нельзя изменять одновременно из нескольких потоков
+ */
+template <typename Type>
+class ImmutableSingleLinkedList {
+    struct Node {
+        template <typename... Args>
+        Node(Node* next, Args&&... args)
+            : next_node(next)
+            , value(std::forward<Args>(args)...) {
+        }
+
+        mutable std::atomic<size_t> ref_count{1};
+        // Узел владеет одной ссылкой на следующий узел.
+        // Связь задаётся только при построении цепочки, пока узел не доступен другим спискам
+        Node* next_node;
+        const Type value;
+    };
+
+    class ConstIteratorImpl {
+        friend class ImmutableSingleLinkedList;
+
+        explicit ConstIteratorImpl(const Node* node) noexcept
+            : node_(node) {
+        }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const Type*;
+        using reference = const Type&;
+
+        ConstIteratorImpl() = default;
+
+        [[nodiscard]] bool operator==(const ConstIteratorImpl& rhs) const noexcept {
+            return node_ == rhs.node_;
+        }
+
+        [[nodiscard]] bool operator!=(const ConstIteratorImpl& rhs) const noexcept {
+            return !(node_ == rhs.node_);
+        }
+
+        // Инкремент итератора, не указывающего на существующий элемент списка, приводит к неопределённому поведению
+        ConstIteratorImpl& operator++() noexcept {
+            assert(node_ != nullptr);
+            node_ = node_->next_node;
+            return *this;
+        }
+
+        ConstIteratorImpl operator++(int) noexcept {
+            auto old_it(*this);
+            ++(*this);
+            return old_it;
+        }
+
+        [[nodiscard]] reference operator*() const noexcept {
+            assert(node_ != nullptr);
+            return node_->value;
+        }
+
+        [[nodiscard]] pointer operator->() const noexcept {
+            assert(node_ != nullptr);
+            return &node_->value;
+        }
+
+    private:
+        const Node* node_ = nullptr;
+    };
+
+public:
+    using value_type = Type;
+    using reference = const value_type&;
+    using const_reference = const value_type&;
+
+    // Элементы неизменяемы, поэтому оба итератора только читают
+    using ConstIterator = ConstIteratorImpl;
+    using Iterator = ConstIterator;
+
+    [[nodiscard]] ConstIterator begin() const noexcept {
+        return ConstIterator{head_};
+    }
+
+    [[nodiscard]] ConstIterator end() const noexcept {
+        return ConstIterator{};
+    }
+
+    [[nodiscard]] ConstIterator cbegin() const noexcept {
+        return begin();
+    }
+
+    [[nodiscard]] ConstIterator cend() const noexcept {
+        return end();
+    }
+
+    ImmutableSingleLinkedList() = default;
+
+    ImmutableSingleLinkedList(std::initializer_list<Type> values);
+
+    template <typename It, typename = std::enable_if_t<std::is_convertible_v<
+                               typename std::iterator_traits<It>::iterator_category, std::input_iterator_tag>>>
+    ImmutableSingleLinkedList(It first, It last);
+
+    // Копирует элементы list в новые узлы за время O(N)
+    template <typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+    explicit ImmutableSingleLinkedList(const SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>& list);
+
+    // Копия разделяет все узлы исходного списка, время O(1)
+    ImmutableSingleLinkedList(const ImmutableSingleLinkedList& other) noexcept;
+
+    ImmutableSingleLinkedList(ImmutableSingleLinkedList&& other) noexcept;
+
+    ImmutableSingleLinkedList& operator=(const ImmutableSingleLinkedList& rhs) noexcept;
+
+    ImmutableSingleLinkedList& operator=(ImmutableSingleLinkedList&& rhs) noexcept;
+
+    // Освобождает узлы, на которые больше не ссылается ни один список, без рекурсии
+    ~ImmutableSingleLinkedList();
+
+    void swap(ImmutableSingleLinkedList& other) noexcept;
+
+    /*
+     * Добавляет элемент в начало за время O(1). Остальные элементы не копируются:
+     * новый узел ссылается на прежний первый узел, который остаётся общим с копиями списка.
+     * Если при создании элемента будет выброшено исключение, список останется в прежнем состоянии
+     */
+    void PushFront(const Type& value);
+
+    void PushFront(Type&& value);
+
+    template <typename... Args>
+    const Type& EmplaceFront(Args&&... args);
+
+    // Переходит ко второму элементу непустого списка за время O(1).
+    // Первый узел освобождается, только если на него не ссылаются другие списки
+    void PopFront() noexcept;
+
+    [[nodiscard]] const Type& Front() const noexcept;
+
+    // Делает список пустым
+    void Clear() noexcept;
+
+    [[nodiscard]] size_t GetSize() const noexcept;
+
+    [[nodiscard]] bool IsEmpty() const noexcept;
+
+    // Сообщает, начинаются ли списки с одного и того же узла, за время O(1)
+    [[nodiscard]] bool IsSameAs(const ImmutableSingleLinkedList& other) const noexcept;
+
+    // Копирует элементы в изменяемый список того же порядка за время O(N)
+    template <typename List = SingleLinkedList<Type>>
+    [[nodiscard]] List ToSingleLinkedList() const;
+
+private:
+    static void AddRef(const Node* node) noexcept;
+
+    // Отпускает ссылку на node и освобождает все узлы, ссылки на которые были последними
+    static void Release(const Node* node) noexcept;
+
+    template <typename It>
+    void MakeList(It first, It last);
+
+    const Node* head_ = nullptr;
+    size_t size_ = 0;
+};
+
+template <typename Type>
+ImmutableSingleLinkedList<Type>::ImmutableSingleLinkedList(std::initializer_list<Type> values) {
+    MakeList(values.begin(), values.end());
+}
+
+template <typename Type>
+template <typename It, typename>
+ImmutableSingleLinkedList<Type>::ImmutableSingleLinkedList(It first, It last) {
+    MakeList(first, last);
+}
+
+template <typename Type>
+template <typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+ImmutableSingleLinkedList<Type>::ImmutableSingleLinkedList(
+    const SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>& list) {
+    MakeList(list.begin(), list.end());
+}
+
+template <typename Type>
+ImmutableSingleLinkedList<Type>::ImmutableSingleLinkedList(const ImmutableSingleLinkedList& other) noexcept
+    : head_(other.head_)
+    , size_(other.size_) {
+    AddRef(head_);
+}
+
+template <typename Type>
+ImmutableSingleLinkedList<Type>::ImmutableSingleLinkedList(ImmutableSingleLinkedList&& other) noexcept
+    : head_(std::exchange(other.head_, nullptr))
+    , size_(std::exchange(other.size_, 0)) {
+}
+
+template <typename Type>
+ImmutableSingleLinkedList<Type>& ImmutableSingleLinkedList<Type>::operator=(const ImmutableSingleLinkedList& rhs) noexcept {
+    // Ссылка на новый узел берётся до освобождения старого, поэтому самоприсваивание безопасно
+    AddRef(rhs.head_);
+    Release(head_);
+    head_ = rhs.head_;
+    size_ = rhs.size_;
+    return *this;
+}
+
+template <typename Type>
+ImmutableSingleLinkedList<Type>& ImmutableSingleLinkedList<Type>::operator=(ImmutableSingleLinkedList&& rhs) noexcept {
+    if (this != &rhs) {
+        Release(head_);
+        head_ = std::exchange(rhs.head_, nullptr);
+        size_ = std::exchange(rhs.size_, 0);
+    }
+    return *this;
+}
+
+template <typename Type>
+ImmutableSingleLinkedList<Type>::~ImmutableSingleLinkedList() {
+    Release(head_);
+}
+
+template <typename Type>
+void ImmutableSingleLinkedList<Type>::swap(ImmutableSingleLinkedList& other) noexcept {
+    std::swap(head_, other.head_);
+    std::swap(size_, other.size_);
+}
+
+template <typename Type>
+void ImmutableSingleLinkedList<Type>::PushFront(const Type& value) {
+    EmplaceFront(value);
+}
+
+template <typename Type>
+void ImmutableSingleLinkedList<Type>::PushFront(Type&& value) {
+    EmplaceFront(std::move(value));
+}
+
+template <typename Type>
+template <typename... Args>
+const Type& ImmutableSingleLinkedList<Type>::EmplaceFront(Args&&... args) {
+    // Ссылка списка на прежний первый узел переходит новому узлу
+    head_ = new Node(const_cast<Node*>(head_), std::forward<Args>(args)...);
+    ++size_;
+    return head_->value;
+}
+
+template <typename Type>
+void ImmutableSingleLinkedList<Type>::PopFront() noexcept {
+    assert(head_ != nullptr);
+    const Node* old_head = head_;
+    head_ = old_head->next_node;
+    AddRef(head_);
+    Release(old_head);
+    --size_;
+}
+
+template <typename Type>
+const Type& ImmutableSingleLinkedList<Type>::Front() const noexcept {
+    assert(head_ != nullptr);
+    return head_->value;
+}
+
+template <typename Type>
+void ImmutableSingleLinkedList<Type>::Clear() noexcept {
+    Release(std::exchange(head_, nullptr));
+    size_ = 0;
+}
+
+template <typename Type>
+size_t ImmutableSingleLinkedList<Type>::GetSize() const noexcept {
+    return size_;
+}
+
+template <typename Type>
+bool ImmutableSingleLinkedList<Type>::IsEmpty() const noexcept {
+    return size_ == 0;
+}
+
+template <typename Type>
+bool ImmutableSingleLinkedList<Type>::IsSameAs(const ImmutableSingleLinkedList& other) const noexcept {
+    return head_ == other.head_;
+}
+
+template <typename Type>
+template <typename List>
+List ImmutableSingleLinkedList<Type>::ToSingleLinkedList() const {
+    return List(begin(), end());
+}
+
+template <typename Type>
+void ImmutableSingleLinkedList<Type>::AddRef(const Node* node) noexcept {
+    if (node != nullptr) {
+        node->ref_count.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+template <typename Type>
+void ImmutableSingleLinkedList<Type>::Release(const Node* node) noexcept {
+    // Как и у std::shared_ptr, последнее уменьшение счётчика синхронизируется со всеми предыдущими
+    while (node != nullptr && node->ref_count.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        const Node* next = node->next_node;
+        delete node;
+        node = next;
+    }
+}
+
+template <typename Type>
+template <typename It>
+void ImmutableSingleLinkedList<Type>::MakeList(It first, It last) {
+    assert(head_ == nullptr);
+    // Цепочка строится за один проход, узлы добавляются в её конец
+    Node* head = nullptr;
+    Node** link = &head;
+    size_t count = 0;
+    try {
+        for (; first != last; ++first) {
+            Node* node = new Node(nullptr, *first);
+            *link = node;
+            link = &node->next_node;
+            ++count;
+        }
+    } catch (...) {
+        Release(head);
+        throw;
+    }
+    head_ = head;
+    size_ = count;
+}
+
+template <typename Type>
+void swap(ImmutableSingleLinkedList<Type>& lhs, ImmutableSingleLinkedList<Type>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+template <typename Type>
+bool operator==(const ImmutableSingleLinkedList<Type>& lhs, const ImmutableSingleLinkedList<Type>& rhs) {
+    // Общие узлы сравнивать не нужно
+    return lhs.GetSize() == rhs.GetSize() && (lhs.IsSameAs(rhs) || std::equal(lhs.begin(), lhs.end(), rhs.begin()));
+}
+
+template <typename Type>
+bool operator!=(const ImmutableSingleLinkedList<Type>& lhs, const ImmutableSingleLinkedList<Type>& rhs) {
+    return !(lhs == rhs);
+}
+
+template <typename Type>
+bool operator<(const ImmutableSingleLinkedList<Type>& lhs, const ImmutableSingleLinkedList<Type>& rhs) {
+    return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename Type>
+bool operator>(const ImmutableSingleLinkedList<Type>& lhs, const ImmutableSingleLinkedList<Type>& rhs) {
+    return rhs < lhs;
+}
+
+template <typename Type>
+bool operator<=(const ImmutableSingleLinkedList<Type>& lhs, const ImmutableSingleLinkedList<Type>& rhs) {
+    return !(rhs < lhs);
+}
+
+template <typename Type>
+bool operator>=(const ImmutableSingleLinkedList<Type>& lhs, const ImmutableSingleLinkedList<Type>& rhs) {
+    return !(lhs < rhs);
+}
@@ -0,0 +1,317 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+// Тег хука по умолчанию
+struct DefaultIntrusiveTag {};
+
+/*
+ * Хук интрузивного списка. Тип элемента наследует IntrusiveListHook<Tag> и тем самым
+ * получает поле связи, которым пользуется IntrusiveSingleLinkedList<Type, Tag>.
+ * Чтобы объект мог одновременно находиться в нескольких списках, он наследует
+ * несколько хуков с разными тегами.
+ * Копирование элемента не копирует связь: копия не находится ни в одном списке
+ */
+template <typename Tag = DefaultIntrusiveTag>
+struct IntrusiveListHook {
+    IntrusiveListHook() = default;
+
+    IntrusiveListHook(const IntrusiveListHook&) noexcept {
+    }
+
+    IntrusiveListHook& operator=(const IntrusiveListHook&) noexcept {
+        return *this;
+    }
+
+    IntrusiveListHook* next_hook = nullptr;
+};
+
+/*
+ * Интрузивный односвязный список. Список не владеет элементами и не выделяет память:
+ * PushFront, InsertAfter, EraseAfter и PopFront только переставляют указатели хуков.
+ * Элемент должен существовать, пока находится в списке, и может находиться
+ * только в одном списке с тем же тегом. Интерфейс повторяет SingleLinkedList
+ */
+template <typename Type, typename Tag = DefaultIntrusiveTag>
+class IntrusiveSingleLinkedList {
+    using Hook = IntrusiveListHook<Tag>;
+
+    static_assert(std::is_base_of_v<Hook, Type>, "Type must inherit IntrusiveListHook<Tag>");
+
+    // Шаблон класса «Базовый Итератор».
+    // Итератор хранит указатель на хук элемента либо на фиктивный хук head_
+    // ValueType — совпадает с Type (для Iterator) либо с const Type (для ConstIterator)
+    template <typename ValueType>
+    class BasicIterator {
+        friend class IntrusiveSingleLinkedList;
+
+        explicit BasicIterator(Hook* hook) noexcept
+            : hook_(hook) {
+        }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = ValueType*;
+        using reference = ValueType&;
+
+        BasicIterator() = default;
+
+        // Конвертирующий конструктор/конструктор копирования
+        BasicIterator(const BasicIterator<Type>& other) noexcept
+            : hook_(other.hook_) {
+        }
+
+        BasicIterator& operator=(const BasicIterator& rhs) = default;
+
+        [[nodiscard]] bool operator==(const BasicIterator<const Type>& rhs) const noexcept {
+            return hook_ == rhs.hook_;
+        }
+
+        [[nodiscard]] bool operator!=(const BasicIterator<const Type>& rhs) const noexcept {
+            return !(hook_ == rhs.hook_);
+        }
+
+        [[nodiscard]] bool operator==(const BasicIterator<Type>& rhs) const noexcept {
+            return hook_ == rhs.hook_;
+        }
+
+        [[nodiscard]] bool operator!=(const BasicIterator<Type>& rhs) const noexcept {
+            return !(hook_ == rhs.hook_);
+        }
+
+        // Инкремент итератора, не указывающего на существующий элемент списка, приводит к неопределённому поведению
+        BasicIterator& operator++() noexcept {
+            if (hook_ != nullptr) {
+                hook_ = hook_->next_hook;
+            }
+            return *this;
+        }
+
+        BasicIterator operator++(int) noexcept {
+            auto old_it(*this);
+            ++(*this);
+            return old_it;
+        }
+
+        [[nodiscard]] reference operator*() const noexcept {
+            assert(hook_ != nullptr);
+            return *static_cast<Type*>(hook_);
+        }
+
+        [[nodiscard]] pointer operator->() const noexcept {
+            assert(hook_ != nullptr);
+            return static_cast<Type*>(hook_);
+        }
+
+    private:
+        Hook* hook_ = nullptr;
+    };
+
+public:
+    using value_type = Type;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+
+    using Iterator = BasicIterator<Type>;
+    using ConstIterator = BasicIterator<const Type>;
+
+    [[nodiscard]] Iterator begin() noexcept {
+        return Iterator{head_.next_hook};
+    }
+
+    [[nodiscard]] Iterator end() noexcept {
+        return Iterator{};
+    }
+
+    [[nodiscard]] ConstIterator begin() const noexcept {
+        return cbegin();
+    }
+
+    [[nodiscard]] ConstIterator end() const noexcept {
+        return cend();
+    }
+
+    [[nodiscard]] ConstIterator cbegin() const noexcept {
+        return ConstIterator{head_.next_hook};
+    }
+
+    [[nodiscard]] ConstIterator cend() const noexcept {
+        return ConstIterator{};
+    }
+
+    // Возвращает итератор, указывающий на позицию перед первым элементом списка.
+    // Разыменовывать этот итератор нельзя - попытка разыменования приведёт к неопределённому поведению
+    [[nodiscard]] Iterator before_begin() noexcept {
+        return Iterator{&head_};
+    }
+
+    [[nodiscard]] ConstIterator cbefore_begin() const noexcept {
+        return ConstIterator{const_cast<Hook*>(&head_)};
+    }
+
+    [[nodiscard]] ConstIterator before_begin() const noexcept {
+        return cbefore_begin();
+    }
+
+    // Возвращает итератор на элемент value, находящийся в списке, за время O(1)
+    [[nodiscard]] static Iterator IteratorTo(Type& value) noexcept {
+        return Iterator{static_cast<Hook*>(&value)};
+    }
+
+    [[nodiscard]] static ConstIterator IteratorTo(const Type& value) noexcept {
+        return ConstIterator{const_cast<Hook*>(static_cast<const Hook*>(&value))};
+    }
+
+    IntrusiveSingleLinkedList() = default;
+
+    // Элемент не может находиться в двух списках с одним тегом, поэтому список нельзя копировать
+    IntrusiveSingleLinkedList(const IntrusiveSingleLinkedList&) = delete;
+    IntrusiveSingleLinkedList& operator=(const IntrusiveSingleLinkedList&) = delete;
+
+    // Перемещение передаёт элементы за время O(1), other становится пустым
+    IntrusiveSingleLinkedList(IntrusiveSingleLinkedList&& other) noexcept;
+
+    IntrusiveSingleLinkedList& operator=(IntrusiveSingleLinkedList&& rhs) noexcept;
+
+    // Отсоединяет элементы, сами элементы не разрушаются
+    ~IntrusiveSingleLinkedList();
+
+    // Обменивает содержимое списков за время O(1)
+    void swap(IntrusiveSingleLinkedList& other) noexcept;
+
+    /*
+     * Присоединяет элемент value после элемента, на который указывает pos, за время O(1).
+     * Возвращает итератор на вставленный элемент
+     */
+    Iterator InsertAfter(ConstIterator pos, Type& value) noexcept;
+
+    /*
+     * Отсоединяет элемент, следующий за pos, за время O(1). Элемент не разрушается.
+     * Возвращает итератор на элемент, следующий за отсоединённым
+     */
+    Iterator EraseAfter(ConstIterator pos) noexcept;
+
+    // Присоединяет элемент value к началу списка за время O(1)
+    void PushFront(Type& value) noexcept;
+
+    // Отсоединяет первый элемент непустого списка за время O(1)
+    void PopFront() noexcept;
+
+    // Возвращает ссылку на первый элемент непустого списка
+    [[nodiscard]] Type& Front() noexcept;
+    [[nodiscard]] const Type& Front() const noexcept;
+
+    // Отсоединяет все элементы за время O(N)
+    void Clear() noexcept;
+
+    [[nodiscard]] size_t GetSize() const noexcept;
+
+    [[nodiscard]] bool IsEmpty() const noexcept;
+
+private:
+    // Фиктивный хук, используется для вставки "перед первым элементом"
+    Hook head_ = {};
+    size_t size_ = 0;
+};
+
+template <typename Type, typename Tag>
+IntrusiveSingleLinkedList<Type, Tag>::IntrusiveSingleLinkedList(IntrusiveSingleLinkedList&& other) noexcept {
+    swap(other);
+}
+
+template <typename Type, typename Tag>
+IntrusiveSingleLinkedList<Type, Tag>& IntrusiveSingleLinkedList<Type, Tag>::operator=(
+    IntrusiveSingleLinkedList&& rhs) noexcept {
+    if (this != &rhs) {
+        Clear();
+        swap(rhs);
+    }
+    return *this;
+}
+
+template <typename Type, typename Tag>
+IntrusiveSingleLinkedList<Type, Tag>::~IntrusiveSingleLinkedList() {
+    Clear();
+}
+
+template <typename Type, typename Tag>
+void IntrusiveSingleLinkedList<Type, Tag>::swap(IntrusiveSingleLinkedList& other) noexcept {
+    std::swap(head_.next_hook, other.head_.next_hook);
+    std::swap(size_, other.size_);
+}
+
+template <typename Type, typename Tag>
+typename IntrusiveSingleLinkedList<Type, Tag>::Iterator IntrusiveSingleLinkedList<Type, Tag>::InsertAfter(
+    ConstIterator pos, Type& value) noexcept {
+    assert(pos.hook_ != nullptr);
+    Hook* hook = static_cast<Hook*>(&value);
+    assert(hook->next_hook == nullptr && hook != pos.hook_);
+    hook->next_hook = pos.hook_->next_hook;
+    pos.hook_->next_hook = hook;
+    ++size_;
+    return Iterator{hook};
+}
+
+template <typename Type, typename Tag>
+typename IntrusiveSingleLinkedList<Type, Tag>::Iterator IntrusiveSingleLinkedList<Type, Tag>::EraseAfter(
+    ConstIterator pos) noexcept {
+    assert(pos.hook_ != nullptr && pos.hook_->next_hook != nullptr);
+    Hook* erased = pos.hook_->next_hook;
+    pos.hook_->next_hook = erased->next_hook;
+    erased->next_hook = nullptr;
+    --size_;
+    return Iterator{pos.hook_->next_hook};
+}
+
+template <typename Type, typename Tag>
+void IntrusiveSingleLinkedList<Type, Tag>::PushFront(Type& value) noexcept {
+    InsertAfter(cbefore_begin(), value);
+}
+
+template <typename Type, typename Tag>
+void IntrusiveSingleLinkedList<Type, Tag>::PopFront() noexcept {
+    assert(size_ > 0);
+    EraseAfter(cbefore_begin());
+}
+
+template <typename Type, typename Tag>
+Type& IntrusiveSingleLinkedList<Type, Tag>::Front() noexcept {
+    assert(size_ > 0);
+    return *static_cast<Type*>(head_.next_hook);
+}
+
+template <typename Type, typename Tag>
+const Type& IntrusiveSingleLinkedList<Type, Tag>::Front() const noexcept {
+    assert(size_ > 0);
+    return *static_cast<const Type*>(head_.next_hook);
+}
+
+template <typename Type, typename Tag>
+void IntrusiveSingleLinkedList<Type, Tag>::Clear() noexcept {
+    // Обнуляем связи, чтобы элементы можно было вставить в другой список
+    while (head_.next_hook != nullptr) {
+        head_.next_hook = std::exchange(head_.next_hook->next_hook, nullptr);
+    }
+    size_ = 0;
+}
+
+template <typename Type, typename Tag>
+size_t IntrusiveSingleLinkedList<Type, Tag>::GetSize() const noexcept {
+    return size_;
+}
+
+template <typename Type, typename Tag>
+bool IntrusiveSingleLinkedList<Type, Tag>::IsEmpty() const noexcept {
+    return size_ == 0;
+}
+
+template <typename Type, typename Tag>
+void swap(IntrusiveSingleLinkedList<Type, Tag>& lhs, IntrusiveSingleLinkedList<Type, Tag>& rhs) noexcept {
+    lhs.swap(rhs);
+}
@@ -0,0 +1,195 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+// Политика по умолчанию: список не собирает статистику, счётчики и обращения к ним исчезают при компиляции
+struct NoListStatistics {};
+
+// Список собирает статистику ListStatistics и регистрирует её в ListStatisticsRegistry.
+// Обходы обычными итераторами (begin()/end(), range-for по списку) не учитываются: узел итератора
+// может перейти в другой список, который переживёт исходный. Учитываемый обход даёт метод Counted()
+struct CollectListStatistics {};
+
+// Снимок статистики одного списка
+struct ListStatisticsSnapshot {
+    // Метка, заданная пользователем, либо nullptr
+    const char* label = nullptr;
+    // Количество выделенных и освобождённых узлов
+    size_t allocations = 0;
+    size_t deallocations = 0;
+    // Наибольший размер, которого достигал список
+    size_t peak_size = 0;
+    // Объём памяти, занятой узлами списка, в байтах
+    size_t bytes_held = 0;
+    // Количество переходов между узлами, выполненных методами обхода, поиска и сравнения списка
+    // (ForEach, Accumulate, CompareTo, At, LowerBound и т.п.)
+    size_t traversal_steps = 0;
+    // Количество инкрементов итераторов диапазона Counted().
+    // Инкременты обычных итераторов списка не учитываются (см. CollectListStatistics)
+    size_t iterator_increments = 0;
+};
+
+/*
+ * Счётчики одного списка. Пока объект существует, он зарегистрирован в ListStatisticsRegistry.
+ * Счётчики изменяет только поток, владеющий списком, поэтому обновление выполняется
+ * парой relaxed-операций без атомарного чтения-изменения-записи, но читать их
+ * можно из любого потока
+ */
+class ListStatistics {
+    friend class ListStatisticsRegistry;
+
+public:
+    ListStatistics() noexcept;
+    ListStatistics(const ListStatistics&) = delete;
+    ListStatistics& operator=(const ListStatistics&) = delete;
+    ~ListStatistics();
+
+    void OnAllocate() noexcept {
+        Add(allocations_, 1);
+    }
+
+    void OnDeallocate(size_t count = 1) noexcept {
+        Add(deallocations_, count);
+    }
+
+    // Запоминает текущий размер списка и объём памяти, занятой его узлами
+    void OnResize(size_t size, size_t node_size) noexcept {
+        if (size > peak_size_.load(std::memory_order_relaxed)) {
+            peak_size_.store(size, std::memory_order_relaxed);
+        }
+        bytes_held_.store(size * node_size, std::memory_order_relaxed);
+    }
+
+    void OnTraverse(size_t steps) noexcept {
+        Add(traversal_steps_, steps);
+    }
+
+    void OnIncrement() noexcept {
+        Add(iterator_increments_, 1);
+    }
+
+    void SetLabel(const char* label) noexcept {
+        label_.store(label, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] ListStatisticsSnapshot GetSnapshot() const noexcept {
+        ListStatisticsSnapshot snapshot;
+        snapshot.label = label_.load(std::memory_order_relaxed);
+        snapshot.allocations = allocations_.load(std::memory_order_relaxed);
+        snapshot.deallocations = deallocations_.load(std::memory_order_relaxed);
+        snapshot.peak_size = peak_size_.load(std::memory_order_relaxed);
+        snapshot.bytes_held = bytes_held_.load(std::memory_order_relaxed);
+        snapshot.traversal_steps = traversal_steps_.load(std::memory_order_relaxed);
+        snapshot.iterator_increments = iterator_increments_.load(std::memory_order_relaxed);
+        return snapshot;
+    }
+
+private:
+    static void Add(std::atomic<size_t>& counter, size_t value) noexcept {
+        counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+
+    // Соседи в списке зарегистрированных объектов. Защищены мьютексом реестра
+    ListStatistics* prev_registered_ = nullptr;
+    ListStatistics* next_registered_ = nullptr;
+
+    std::atomic<const char*> label_{nullptr};
+    std::atomic<size_t> allocations_{0};
+    std::atomic<size_t> deallocations_{0};
+    std::atomic<size_t> peak_size_{0};
+    std::atomic<size_t> bytes_held_{0};
+    std::atomic<size_t> traversal_steps_{0};
+    std::atomic<size_t> iterator_increments_{0};
+};
+
+// Реестр статистики всех существующих списков, собирающих статистику.
+// Объекты статистики объединены в интрузивный двусвязный список, поэтому
+// регистрация не выделяет память и выполняется за время O(1)
+class ListStatisticsRegistry {
+public:
+    ListStatisticsRegistry() = default;
+    ListStatisticsRegistry(const ListStatisticsRegistry&) = delete;
+    ListStatisticsRegistry& operator=(const ListStatisticsRegistry&) = delete;
+
+    // Возвращает общий для всей программы реестр.
+    // Реестр намеренно не разрушается, чтобы статические списки могли выписаться из него при завершении программы
+    static ListStatisticsRegistry& Instance() {
+        static ListStatisticsRegistry* registry = new ListStatisticsRegistry();
+        return *registry;
+    }
+
+    void Register(ListStatistics* statistics) noexcept {
+        std::lock_guard guard(mutex_);
+        statistics->next_registered_ = first_;
+        if (first_ != nullptr) {
+            first_->prev_registered_ = statistics;
+        }
+        first_ = statistics;
+        ++count_;
+    }
+
+    void Unregister(ListStatistics* statistics) noexcept {
+        std::lock_guard guard(mutex_);
+        if (statistics->prev_registered_ != nullptr) {
+            statistics->prev_registered_->next_registered_ = statistics->next_registered_;
+        } else {
+            first_ = statistics->next_registered_;
+        }
+        if (statistics->next_registered_ != nullptr) {
+            statistics->next_registered_->prev_registered_ = statistics->prev_registered_;
+        }
+        --count_;
+    }
+
+    // Возвращает снимки статистики всех списков, упорядоченные по убыванию нагрузки:
+    // сначала по числу выделений узлов, затем по числу переходов между узлами вместе с инкрементами итераторов
+    [[nodiscard]] std::vector<ListStatisticsSnapshot> Collect() const {
+        std::vector<ListStatisticsSnapshot> snapshots;
+        {
+            std::lock_guard guard(mutex_);
+            snapshots.reserve(count_);
+            for (const ListStatistics* statistics = first_; statistics != nullptr;
+                 statistics = statistics->next_registered_) {
+                snapshots.push_back(statistics->GetSnapshot());
+            }
+        }
+        std::sort(snapshots.begin(), snapshots.end(), [](const auto& lhs, const auto& rhs) {
+            if (lhs.allocations != rhs.allocations) {
+                return lhs.allocations > rhs.allocations;
+            }
+            return lhs.traversal_steps + lhs.iterator_increments > rhs.traversal_steps + rhs.iterator_increments;
+        });
+        return snapshots;
+    }
+
+    // Выводит статистику всех списков, по одной строке на список
+    void Dump(std::ostream& out) const {
+        for (const ListStatisticsSnapshot& snapshot : Collect()) {
+            out << (snapshot.label != nullptr ? snapshot.label : "<unnamed>")
+                << ": allocations=" << snapshot.allocations
+                << " deallocations=" << snapshot.deallocations
+                << " peak_size=" << snapshot.peak_size
+                << " bytes_held=" << snapshot.bytes_held
+                << " traversal_steps=" << snapshot.traversal_steps
+                << " iterator_increments=" << snapshot.iterator_increments << '\n';
+        }
+    }
+
+private:
+    mutable std::mutex mutex_;
+    ListStatistics* first_ = nullptr;
+    size_t count_ = 0;
+};
+
+inline ListStatistics::ListStatistics() noexcept {
+    ListStatisticsRegistry::Instance().Register(this);
+}
+
+inline ListStatistics::~ListStatistics() {
+    ListStatisticsRegistry::Instance().Unregister(this);
+}
@@ -1,9 +1,38 @@
 //6 sprint
 
 #include "single-linked-list.h"
+#include "node-pool.h"
+#include "node-arena.h"
+#include "unrolled-single-linked-list.h"
+#include "intrusive-single-linked-list.h"
+#include "compact-single-linked-list.h"
+#include "persistent-single-linked-list.h"
+#include "small-single-linked-list.h"
+#include "immutable-single-linked-list.h"
+#include "static-single-linked-list.h"
+#include "concurrent-single-linked-list.h"
+#include "async-single-linked-channel.h"
 #include "test-single-linked-list.h"
+#include "test-unrolled-single-linked-list.h"
+#include "test-intrusive-single-linked-list.h"
+#include "test-compact-single-linked-list.h"
+#include "test-persistent-single-linked-list.h"
+#include "test-small-single-linked-list.h"
+#include "test-immutable-single-linked-list.h"
+#include "test-static-single-linked-list.h"
+#include "test-concurrent-single-linked-list.h"
+#include "test-async-single-linked-channel.h"
 
 int main() {
     Test();
+    TestUnrolledList();
+    TestIntrusiveList();
+    TestCompactList();
+    TestPersistentList();
+    TestSmallList();
+    TestImmutableList();
+    TestStaticList();
+    TestConcurrentList();
+    TestAsyncChannel();
     return 0;
 }
@@ -0,0 +1,342 @@
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Выравнивание начала каждого куска арены. Блоки с большим выравниванием арена не выдаёт
+inline constexpr size_t ARENA_CHUNK_ALIGN = 64;
+
+// Заголовок куска памяти арены. Куски объединены в односвязный список
+struct ArenaChunk {
+    ArenaChunk* next = nullptr;
+    // Полный размер куска вместе с заголовком
+    size_t size = 0;
+};
+
+// Освобождает цепочку кусков, начиная с chunk
+inline void FreeArenaChunks(ArenaChunk* chunk) noexcept {
+    while (chunk != nullptr) {
+        ArenaChunk* next = chunk->next;
+        ::operator delete(chunk, chunk->size, std::align_val_t{ARENA_CHUNK_ALIGN});
+        chunk = next;
+    }
+}
+
+/*
+ * Фоновый поток, освобождающий куски арен, которые передала ему ArenaAllocator::ReleaseAllAsync.
+ * Передача цепочки кусков не выделяет память и не ждёт освобождения
+ */
+class ArenaReclaimer {
+public:
+    ArenaReclaimer(const ArenaReclaimer&) = delete;
+    ArenaReclaimer& operator=(const ArenaReclaimer&) = delete;
+
+    // Возвращает общий для всей программы поток освобождения и запускает его при первом обращении.
+    // Объект намеренно не разрушается, чтобы списки могли освобождать память при завершении программы
+    static ArenaReclaimer& Instance() {
+        static ArenaReclaimer* reclaimer = new ArenaReclaimer();
+        return *reclaimer;
+    }
+
+    // Передаёт цепочку кусков фоновому потоку
+    void Push(ArenaChunk* first) noexcept {
+        if (first == nullptr) {
+            return;
+        }
+        ArenaChunk* last = first;
+        while (last->next != nullptr) {
+            last = last->next;
+        }
+        {
+            std::lock_guard guard(mutex_);
+            last->next = pending_;
+            pending_ = first;
+        }
+        work_ready_.notify_one();
+    }
+
+    // Ожидает, пока все переданные куски будут освобождены
+    void Wait() {
+        std::unique_lock lock(mutex_);
+        idle_.wait(lock, [this] {
+            return pending_ == nullptr && !busy_;
+        });
+    }
+
+private:
+    ArenaReclaimer()
+        : thread_([this] {
+            Run();
+        }) {
+        thread_.detach();
+    }
+
+    void Run() noexcept {
+        std::unique_lock lock(mutex_);
+        while (true) {
+            work_ready_.wait(lock, [this] {
+                return pending_ != nullptr;
+            });
+            ArenaChunk* chunks = std::exchange(pending_, nullptr);
+            busy_ = true;
+            lock.unlock();
+            FreeArenaChunks(chunks);
+            lock.lock();
+            busy_ = false;
+            if (pending_ == nullptr) {
+                idle_.notify_all();
+            }
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable work_ready_;
+    std::condition_variable idle_;
+    ArenaChunk* pending_ = nullptr;
+    bool busy_ = false;
+    std::thread thread_;
+};
+
+/*
+ * Арена, из которой выделяются узлы одного списка.
+ * Блоки нарезаются из кусков, размер которых удваивается; освобождённые блоки
+ * попадают в список свободных блоков своего размера и выдаются повторно.
+ * Арена подсчитывает живые блоки, поэтому владелец, знающий, что все они принадлежат ему,
+ * может освободить память целиком за время O(числа кусков), не обходя блоки.
+ * Арена не потокобезопасна, как и список, которому она принадлежит
+ */
+class NodeArena {
+public:
+    NodeArena() = default;
+    NodeArena(const NodeArena&) = delete;
+    NodeArena& operator=(const NodeArena&) = delete;
+
+    ~NodeArena() {
+        FreeArenaChunks(chunks_);
+    }
+
+    [[nodiscard]] void* Allocate(size_t size, size_t align) {
+        const size_t block_size = GetBlockSize(size, align);
+        FreeList& free_list = GetFreeList(block_size);
+        void* block = nullptr;
+        if (free_list.first != nullptr) {
+            block = std::exchange(free_list.first, free_list.first->next);
+        } else {
+            block = Carve(block_size, std::max(align, alignof(FreeBlock)));
+        }
+        ++live_count_;
+        return block;
+    }
+
+    // Возвращает блок в список свободных блоков его размера за время O(1)
+    void Deallocate(void* ptr, size_t size, size_t align) noexcept {
+        const size_t block_size = GetBlockSize(size, align);
+        // Список свободных блоков этого размера создан при выделении блока
+        auto it = std::find_if(free_lists_.begin(), free_lists_.end(), [block_size](const FreeList& free_list) {
+            return free_list.block_size == block_size;
+        });
+        it->first = ::new (ptr) FreeBlock{it->first};
+        --live_count_;
+    }
+
+    // Количество выделенных и ещё не освобождённых блоков
+    [[nodiscard]] size_t GetLiveCount() const noexcept {
+        return live_count_;
+    }
+
+    // Количество кусков памяти арены
+    [[nodiscard]] size_t GetChunkCount() const noexcept {
+        return chunk_count_;
+    }
+
+    // Если в арене ровно expected_live живых блоков, освобождает все куски и возвращает true.
+    // Иначе ничего не делает и возвращает false
+    bool ReleaseAll(size_t expected_live) noexcept {
+        if (live_count_ != expected_live) {
+            return false;
+        }
+        FreeArenaChunks(DetachChunks());
+        return true;
+    }
+
+    // То же, что ReleaseAll, но куски освобождает фоновый поток ArenaReclaimer
+    bool ReleaseAllAsync(size_t expected_live) noexcept {
+        if (live_count_ != expected_live) {
+            return false;
+        }
+        ArenaChunk* chunks = DetachChunks();
+        try {
+            ArenaReclaimer::Instance().Push(chunks);
+        } catch (...) {
+            // Поток освобождения не удалось запустить
+            FreeArenaChunks(chunks);
+        }
+        return true;
+    }
+
+private:
+    static constexpr size_t HEADER_SIZE = (sizeof(ArenaChunk) + ARENA_CHUNK_ALIGN - 1) / ARENA_CHUNK_ALIGN * ARENA_CHUNK_ALIGN;
+    static constexpr size_t MIN_CHUNK_SIZE = 4 * 1024;
+    static constexpr size_t MAX_CHUNK_SIZE = 16 * 1024 * 1024;
+
+    // Свободный блок хранит указатель на следующий свободный блок того же размера
+    struct FreeBlock {
+        FreeBlock* next = nullptr;
+    };
+
+    struct FreeList {
+        size_t block_size = 0;
+        FreeBlock* first = nullptr;
+    };
+
+    // Размер блока, достаточный для size байт и для заголовка свободного блока
+    static size_t GetBlockSize(size_t size, size_t align) noexcept {
+        const size_t block_align = std::max(align, alignof(FreeBlock));
+        return (std::max(size, sizeof(FreeBlock)) + block_align - 1) / block_align * block_align;
+    }
+
+    FreeList& GetFreeList(size_t block_size) {
+        for (FreeList& free_list : free_lists_) {
+            if (free_list.block_size == block_size) {
+                return free_list;
+            }
+        }
+        return free_lists_.emplace_back(FreeList{block_size, nullptr});
+    }
+
+    // Отрезает блок от текущего куска. Если места не хватает, выделяет новый кусок
+    void* Carve(size_t block_size, size_t align) {
+        if (align > ARENA_CHUNK_ALIGN) {
+            throw std::bad_alloc();
+        }
+        std::byte* block = AlignUp(cursor_, align);
+        if (cursor_ == nullptr || block > chunk_end_ || block_size > static_cast<size_t>(chunk_end_ - block)) {
+            Grow(block_size);
+            block = cursor_;
+        }
+        cursor_ = block + block_size;
+        return block;
+    }
+
+    void Grow(size_t block_size) {
+        const size_t chunk_size = std::max(next_chunk_size_, HEADER_SIZE + block_size);
+        void* memory = ::operator new(chunk_size, std::align_val_t{ARENA_CHUNK_ALIGN});
+        chunks_ = ::new (memory) ArenaChunk{chunks_, chunk_size};
+        ++chunk_count_;
+        cursor_ = static_cast<std::byte*>(memory) + HEADER_SIZE;
+        chunk_end_ = static_cast<std::byte*>(memory) + chunk_size;
+        next_chunk_size_ = std::min(next_chunk_size_ * 2, MAX_CHUNK_SIZE);
+    }
+
+    static std::byte* AlignUp(std::byte* ptr, size_t align) noexcept {
+        const auto address = reinterpret_cast<std::uintptr_t>(ptr);
+        return ptr + ((align - address % align) % align);
+    }
+
+    // Забирает все куски, возвращая арену в исходное состояние
+    ArenaChunk* DetachChunks() noexcept {
+        for (FreeList& free_list : free_lists_) {
+            free_list.first = nullptr;
+        }
+        cursor_ = nullptr;
+        chunk_end_ = nullptr;
+        chunk_count_ = 0;
+        live_count_ = 0;
+        next_chunk_size_ = MIN_CHUNK_SIZE;
+        return std::exchange(chunks_, nullptr);
+    }
+
+    std::vector<FreeList> free_lists_;
+    ArenaChunk* chunks_ = nullptr;
+    std::byte* cursor_ = nullptr;
+    std::byte* chunk_end_ = nullptr;
+    size_t chunk_count_ = 0;
+    size_t live_count_ = 0;
+    size_t next_chunk_size_ = MIN_CHUNK_SIZE;
+};
+
+/*
+ * Аллокатор, выделяющий память из собственной арены NodeArena.
+ * Копии аллокатора разделяют арену, а копия контейнера получает новую
+ * (select_on_container_copy_construction), поэтому каждый список владеет своей ареной.
+ * Список, узлы которого тривиально разрушаемы, освобождает такую арену целиком
+ * (см. SingleLinkedList::Clear и SingleLinkedList::ClearAsync)
+ */
+template <typename Type>
+class ArenaAllocator {
+    template <typename Other>
+    friend class ArenaAllocator;
+
+public:
+    using value_type = Type;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+    using is_always_equal = std::false_type;
+
+    ArenaAllocator()
+        : arena_(std::make_shared<NodeArena>()) {
+    }
+
+    // Перемещение выполняется копированием, чтобы у аллокатора всегда была арена
+    ArenaAllocator(const ArenaAllocator&) noexcept = default;
+    ArenaAllocator& operator=(const ArenaAllocator&) noexcept = default;
+
+    template <typename Other>
+    ArenaAllocator(const ArenaAllocator<Other>& other) noexcept
+        : arena_(other.arena_) {
+    }
+
+    // Копия контейнера получает собственную арену
+    [[nodiscard]] ArenaAllocator select_on_container_copy_construction() const {
+        return ArenaAllocator();
+    }
+
+    [[nodiscard]] Type* allocate(size_t n) {
+        if (n > std::numeric_limits<size_t>::max() / sizeof(Type)) {
+            throw std::bad_array_new_length();
+        }
+        return static_cast<Type*>(arena_->Allocate(n * sizeof(Type), alignof(Type)));
+    }
+
+    void deallocate(Type* ptr, size_t n) noexcept {
+        arena_->Deallocate(ptr, n * sizeof(Type), alignof(Type));
+    }
+
+    // Освобождает арену целиком, если все expected_live живых блоков принадлежат вызывающему
+    bool ReleaseAll(size_t expected_live) noexcept {
+        return arena_->ReleaseAll(expected_live);
+    }
+
+    // То же, что ReleaseAll, но память освобождается в фоновом потоке
+    bool ReleaseAllAsync(size_t expected_live) noexcept {
+        return arena_->ReleaseAllAsync(expected_live);
+    }
+
+    [[nodiscard]] const NodeArena& GetArena() const noexcept {
+        return *arena_;
+    }
+
+    template <typename Other>
+    bool operator==(const ArenaAllocator<Other>& other) const noexcept {
+        return arena_ == other.arena_;
+    }
+
+    template <typename Other>
+    bool operator!=(const ArenaAllocator<Other>& other) const noexcept {
+        return arena_ != other.arena_;
+    }
+
+private:
+    std::shared_ptr<NodeArena> arena_;
+};
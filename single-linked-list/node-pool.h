@@ -0,0 +1,292 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+
+// Пул блоков фиксированного размера.
+// Блоки выделяются из непрерывных кусков (chunk) памяти, освобождённые блоки
+// попадают в список свободных блоков и выдаются повторно, поэтому в установившемся
+// режиме выделение и освобождение блоков не обращаются к куче
+template <size_t BlockSize, size_t BlockAlign>
+class NodePool {
+public:
+    // Свободный блок хранит указатель на следующий свободный блок
+    struct FreeBlock {
+        FreeBlock* next = nullptr;
+    };
+
+private:
+    // Заголовок куска памяти. Куски объединены в односвязный список
+    struct Chunk {
+        Chunk* next = nullptr;
+        size_t block_count = 0;
+    };
+
+public:
+    static constexpr size_t BLOCK_ALIGN = std::max(BlockAlign, alignof(FreeBlock));
+    static constexpr size_t BLOCK_SIZE
+        = (std::max(BlockSize, sizeof(FreeBlock)) + BLOCK_ALIGN - 1) / BLOCK_ALIGN * BLOCK_ALIGN;
+
+    NodePool() = default;
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    ~NodePool() {
+        while (chunks_) {
+            Chunk* next = chunks_->next;
+            ::operator delete(chunks_, std::align_val_t{CHUNK_ALIGN});
+            chunks_ = next;
+        }
+    }
+
+    // Возвращает общий для всей программы пул блоков данного размера.
+    // Пул намеренно не разрушается, чтобы статические списки могли вернуть
+    // в него узлы при завершении программы
+    static NodePool& Instance() {
+        static NodePool* pool = new NodePool();
+        return *pool;
+    }
+
+    // Выделяет блок. Если свободных блоков нет, выделяет новый кусок,
+    // вдвое больший предыдущего
+    [[nodiscard]] void* Allocate() {
+        std::lock_guard guard(mutex_);
+        if (!free_list_) {
+            Grow();
+        }
+        FreeBlock* block = free_list_;
+        free_list_ = block->next;
+        return block;
+    }
+
+    // Возвращает блок в список свободных блоков за время O(1)
+    void Deallocate(void* ptr) noexcept {
+        std::lock_guard guard(mutex_);
+        free_list_ = ::new (ptr) FreeBlock{free_list_};
+    }
+
+    // Выделяет count блоков за один захват мьютекса и возвращает их связанными в список
+    // в порядке списка свободных блоков. Последний блок списка указывает на nullptr.
+    // Если выделить новый кусок не удалось, уже отобранные блоки возвращаются в список свободных блоков
+    [[nodiscard]] FreeBlock* AllocateBatch(size_t count) {
+        std::lock_guard guard(mutex_);
+        FreeBlock* first = nullptr;
+        FreeBlock** link = &first;
+        try {
+            for (; count > 0; --count) {
+                if (!free_list_) {
+                    Grow();
+                }
+                *link = free_list_;
+                link = &free_list_->next;
+                free_list_ = free_list_->next;
+            }
+        } catch (...) {
+            *link = free_list_;
+            free_list_ = first;
+            throw;
+        }
+        *link = nullptr;
+        return first;
+    }
+
+    // Возвращает список свободных блоков [first, last] за один захват мьютекса
+    void DeallocateBatch(FreeBlock* first, FreeBlock* last) noexcept {
+        std::lock_guard guard(mutex_);
+        last->next = free_list_;
+        free_list_ = first;
+    }
+
+    // Количество блоков, выделенных во всех кусках пула
+    [[nodiscard]] size_t GetCapacity() const noexcept {
+        std::lock_guard guard(mutex_);
+        return capacity_;
+    }
+
+private:
+    static constexpr size_t CHUNK_ALIGN = std::max(BLOCK_ALIGN, alignof(Chunk));
+    static constexpr size_t HEADER_SIZE = (sizeof(Chunk) + BLOCK_ALIGN - 1) / BLOCK_ALIGN * BLOCK_ALIGN;
+    static constexpr size_t MIN_CHUNK_BLOCKS = 64;
+    static constexpr size_t MAX_CHUNK_BLOCKS = 64 * 1024;
+
+    void Grow() {
+        const size_t block_count = next_chunk_blocks_;
+        void* memory = ::operator new(HEADER_SIZE + block_count * BLOCK_SIZE, std::align_val_t{CHUNK_ALIGN});
+        chunks_ = ::new (memory) Chunk{chunks_, block_count};
+
+        std::byte* blocks = static_cast<std::byte*>(memory) + HEADER_SIZE;
+        // Блоки связываются в порядке возрастания адресов, чтобы последовательно
+        // выделенные узлы лежали в памяти рядом
+        for (size_t i = block_count; i > 0; --i) {
+            free_list_ = ::new (blocks + (i - 1) * BLOCK_SIZE) FreeBlock{free_list_};
+        }
+        capacity_ += block_count;
+        next_chunk_blocks_ = std::min(next_chunk_blocks_ * 2, MAX_CHUNK_BLOCKS);
+    }
+
+    mutable std::mutex mutex_;
+    FreeBlock* free_list_ = nullptr;
+    Chunk* chunks_ = nullptr;
+    size_t capacity_ = 0;
+    size_t next_chunk_blocks_ = MIN_CHUNK_BLOCKS;
+};
+
+/*
+ * Кэш свободных блоков потока перед общим пулом NodePool, по аналогии с кэшами tcmalloc.
+ * Выделение и освобождение работают со списком блоков текущего потока без захвата мьютекса.
+ * Пустой кэш пополняется из пула пакетом из BATCH_SIZE блоков, а заполненный кэш возвращает пакет в пул,
+ * поэтому кэш хранит не больше MAX_CACHED_BLOCKS блоков, а к мьютексу пула обращается
+ * не больше одной операции из BATCH_SIZE.
+ * Блок, освобождённый в другом потоке, попадает в кэш этого потока.
+ * При завершении потока кэш возвращает все блоки в пул
+ */
+template <size_t BlockSize, size_t BlockAlign>
+class NodeCache {
+    using Pool = NodePool<BlockSize, BlockAlign>;
+    using FreeBlock = typename Pool::FreeBlock;
+
+public:
+    static constexpr size_t BATCH_SIZE = 32;
+    static constexpr size_t MAX_CACHED_BLOCKS = 2 * BATCH_SIZE;
+
+    [[nodiscard]] static void* Allocate() {
+        State& state = state_;
+        if (state.count == 0 && !Refill(state)) {
+            return Pool::Instance().Allocate();
+        }
+        FreeBlock* block = state.first;
+        state.first = block->next;
+        --state.count;
+        return block;
+    }
+
+    static void Deallocate(void* ptr) noexcept {
+        State& state = state_;
+        if (state.count == 0 && !Register(state)) {
+            Pool::Instance().Deallocate(ptr);
+            return;
+        }
+        if (state.count == MAX_CACHED_BLOCKS) {
+            Flush(state, BATCH_SIZE);
+        }
+        state.first = ::new (ptr) FreeBlock{state.first};
+        ++state.count;
+    }
+
+    // Количество блоков в кэше текущего потока
+    [[nodiscard]] static size_t GetCachedCount() noexcept {
+        return state_.count;
+    }
+
+    // Возвращает в пул все блоки из кэша текущего потока
+    static void Release() noexcept {
+        State& state = state_;
+        Flush(state, state.count);
+    }
+
+private:
+    // Состояние кэша тривиально и не разрушается, поэтому к нему можно обращаться
+    // и после разрушения остальных объектов потока: например, из деструкторов статических списков
+    struct State {
+        FreeBlock* first;
+        size_t count;
+        bool registered;
+        // Поток завершается: блоки идут напрямую в пул
+        bool finished;
+    };
+
+    // Возвращает блоки в пул при завершении потока
+    struct ReleaseOnExit {
+        ~ReleaseOnExit() {
+            Release();
+            state_.finished = true;
+        }
+    };
+
+    // Регистрирует возврат блоков при завершении потока перед тем, как в пустой кэш попадёт первый блок.
+    // Возвращает false, если поток завершается и кэш больше не используется
+    static bool Register(State& state) noexcept {
+        if (state.finished) {
+            return false;
+        }
+        if (!state.registered) {
+            static thread_local ReleaseOnExit release_on_exit;
+            state.registered = true;
+        }
+        return true;
+    }
+
+    // Пополняет пустой кэш. Возвращает false, если кэш больше не используется
+    static bool Refill(State& state) {
+        if (!Register(state)) {
+            return false;
+        }
+        state.first = Pool::Instance().AllocateBatch(BATCH_SIZE);
+        state.count = BATCH_SIZE;
+        return true;
+    }
+
+    // Возвращает в пул count первых блоков кэша
+    static void Flush(State& state, size_t count) noexcept {
+        if (count == 0) {
+            return;
+        }
+        FreeBlock* first = state.first;
+        FreeBlock* last = first;
+        for (size_t i = 1; i < count; ++i) {
+            last = last->next;
+        }
+        state.first = last->next;
+        state.count -= count;
+        Pool::Instance().DeallocateBatch(first, last);
+    }
+
+    static inline thread_local State state_ = {};
+};
+
+// Аллокатор, выделяющий одиночные объекты из общего пула NodePool через кэш потока NodeCache.
+// Не хранит состояния, поэтому все его экземпляры равны между собой.
+// Запросы на выделение массивов передаются std::allocator
+template <typename Type>
+class PoolAllocator {
+public:
+    using value_type = Type;
+    using is_always_equal = std::true_type;
+
+    PoolAllocator() noexcept = default;
+
+    template <typename Other>
+    PoolAllocator(const PoolAllocator<Other>&) noexcept {
+    }
+
+    [[nodiscard]] Type* allocate(size_t n) {
+        if (n == 1) {
+            return static_cast<Type*>(Cache::Allocate());
+        }
+        return std::allocator<Type>{}.allocate(n);
+    }
+
+    void deallocate(Type* ptr, size_t n) noexcept {
+        if (n == 1) {
+            Cache::Deallocate(ptr);
+        } else {
+            std::allocator<Type>{}.deallocate(ptr, n);
+        }
+    }
+
+private:
+    using Cache = NodeCache<sizeof(Type), alignof(Type)>;
+};
+
+template <typename Lhs, typename Rhs>
+bool operator==(const PoolAllocator<Lhs>&, const PoolAllocator<Rhs>&) noexcept {
+    return true;
+}
+
+template <typename Lhs, typename Rhs>
+bool operator!=(const PoolAllocator<Lhs>&, const PoolAllocator<Rhs>&) noexcept {
+    return false;
+}
@@ -0,0 +1,550 @@
+#pragma once
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+// Режим открытия файла PersistentSingleLinkedList
+enum class PersistentOpenMode {
+    // Только чтение. Изменяющие методы и методы, выдающие изменяемый доступ к элементам
+    // (неконстантные Front, begin и before_begin), выбрасывают std::logic_error
+    ReadOnly,
+    // Чтение и запись. Отсутствующий файл создаётся
+    ReadWrite,
+};
+
+/*
+ * Односвязный список, узлы которого хранятся в отображённом в память файле (POSIX mmap).
+ * Вместо указателей узлы хранят смещения от начала файла, поэтому файл можно
+ * отобразить по любому адресу: открытие не обходит узлы и выполняется за время O(1),
+ * а изменения сразу попадают в файл. Type должен быть тривиально копируемым
+ * и не должен содержать указателей.
+ *
+ * Узлы выделяются из файла: освобождённые узлы попадают в список свободных узлов
+ * внутри файла, новые отрезаются от конца занятой области. Когда место кончается,
+ * файл увеличивается вдвое и отображается заново; при этом, как у std::vector,
+ * все итераторы и ссылки на элементы становятся недействительными (см. Reserve).
+ * Формат файла зависит от платформы. Список не потокобезопасен, и файл
+ * не должен одновременно изменяться несколькими процессами
+ */
+template <typename Type>
+class PersistentSingleLinkedList {
+    static_assert(std::is_trivially_copyable_v<Type>, "PersistentSingleLinkedList requires a trivially copyable Type");
+
+    // Смещение от начала файла. Нулевое смещение занято заголовком и обозначает отсутствие узла
+    using Offset = std::uint64_t;
+
+    struct Link {
+        Offset next = 0;
+    };
+
+    struct Node : Link {
+        Type value;
+    };
+
+    struct Header {
+        std::uint64_t magic = 0;
+        std::uint32_t version = 0;
+        // Размер и выравнивание элемента и узла, для которых записан файл
+        std::uint32_t value_size = 0;
+        std::uint32_t value_align = 0;
+        std::uint32_t node_size = 0;
+        // Конец занятой узлами области файла
+        Offset used = 0;
+        // Первый свободный узел
+        Offset free_list = 0;
+        std::uint64_t size = 0;
+        // Фиктивный узел, используется для вставки "перед первым элементом"
+        Link head;
+    };
+
+    static constexpr std::uint64_t MAGIC = 0x5453494c4b4e494cULL;
+    static constexpr std::uint32_t VERSION = 1;
+    static constexpr Offset HEAD_OFFSET = offsetof(Header, head);
+    static constexpr Offset FIRST_NODE_OFFSET = (sizeof(Header) + alignof(Node) - 1) / alignof(Node) * alignof(Node);
+    static constexpr size_t MIN_FILE_SIZE = 64 * 1024;
+
+    // Шаблон класса «Базовый Итератор».
+    // Итератор хранит адрес отображения и смещение узла либо смещение фиктивного узла head
+    // ValueType — совпадает с Type (для Iterator) либо с const Type (для ConstIterator)
+    template <typename ValueType>
+    class BasicIterator {
+        friend class PersistentSingleLinkedList;
+
+        BasicIterator(std::byte* base, Offset offset) noexcept
+            : base_(base)
+            , offset_(offset) {
+        }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = ValueType*;
+        using reference = ValueType&;
+
+        BasicIterator() = default;
+
+        // Конвертирующий конструктор/конструктор копирования
+        BasicIterator(const BasicIterator<Type>& other) noexcept
+            : base_(other.base_)
+            , offset_(other.offset_) {
+        }
+
+        BasicIterator& operator=(const BasicIterator& rhs) = default;
+
+        [[nodiscard]] bool operator==(const BasicIterator<const Type>& rhs) const noexcept {
+            return offset_ == rhs.offset_;
+        }
+
+        [[nodiscard]] bool operator!=(const BasicIterator<const Type>& rhs) const noexcept {
+            return !(offset_ == rhs.offset_);
+        }
+
+        [[nodiscard]] bool operator==(const BasicIterator<Type>& rhs) const noexcept {
+            return offset_ == rhs.offset_;
+        }
+
+        [[nodiscard]] bool operator!=(const BasicIterator<Type>& rhs) const noexcept {
+            return !(offset_ == rhs.offset_);
+        }
+
+        // Инкремент итератора, не указывающего на существующий элемент списка, приводит к неопределённому поведению
+        BasicIterator& operator++() noexcept {
+            assert(offset_ != 0);
+            offset_ = reinterpret_cast<const Link*>(base_ + offset_)->next;
+            return *this;
+        }
+
+        BasicIterator operator++(int) noexcept {
+            auto old_it(*this);
+            ++(*this);
+            return old_it;
+        }
+
+        [[nodiscard]] reference operator*() const noexcept {
+            assert(offset_ != 0 && offset_ != HEAD_OFFSET);
+            return reinterpret_cast<Node*>(base_ + offset_)->value;
+        }
+
+        [[nodiscard]] pointer operator->() const noexcept {
+            return &**this;
+        }
+
+    private:
+        std::byte* base_ = nullptr;
+        Offset offset_ = 0;
+    };
+
+public:
+    using value_type = Type;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+
+    using Iterator = BasicIterator<Type>;
+    using ConstIterator = BasicIterator<const Type>;
+
+    // Изменяющие итераторы, как и неконстантный Front, выдаются только списком, открытым для записи:
+    // для списка только для чтения неконстантные begin и before_begin выбрасывают std::logic_error,
+    // а читать его следует через константные методы (cbegin, cbefore_begin)
+    [[nodiscard]] Iterator begin() {
+        CheckWritable();
+        return Iterator{base_, GetHeader().head.next};
+    }
+
+    [[nodiscard]] Iterator end() noexcept {
+        return Iterator{};
+    }
+
+    [[nodiscard]] ConstIterator begin() const noexcept {
+        return cbegin();
+    }
+
+    [[nodiscard]] ConstIterator end() const noexcept {
+        return cend();
+    }
+
+    [[nodiscard]] ConstIterator cbegin() const noexcept {
+        return ConstIterator{base_, GetHeader().head.next};
+    }
+
+    [[nodiscard]] ConstIterator cend() const noexcept {
+        return ConstIterator{};
+    }
+
+    // Возвращает итератор, указывающий на позицию перед первым элементом списка.
+    // Разыменовывать этот итератор нельзя - попытка разыменования приведёт к неопределённому поведению
+    [[nodiscard]] Iterator before_begin() {
+        CheckWritable();
+        return Iterator{base_, HEAD_OFFSET};
+    }
+
+    [[nodiscard]] ConstIterator cbefore_begin() const noexcept {
+        return ConstIterator{base_, HEAD_OFFSET};
+    }
+
+    [[nodiscard]] ConstIterator before_begin() const noexcept {
+        return cbefore_begin();
+    }
+
+    /*
+     * Открывает файл path и отображает его в память за время O(1).
+     * Ошибки операционной системы выбрасываются как std::system_error,
+     * файл, созданный не этим классом или для другого Type, - как std::runtime_error
+     */
+    explicit PersistentSingleLinkedList(const std::string& path, PersistentOpenMode mode = PersistentOpenMode::ReadWrite);
+
+    PersistentSingleLinkedList(const PersistentSingleLinkedList&) = delete;
+    PersistentSingleLinkedList& operator=(const PersistentSingleLinkedList&) = delete;
+
+    // Перемещение передаёт открытый файл. Перемещённый список можно только разрушить или присвоить
+    PersistentSingleLinkedList(PersistentSingleLinkedList&& other) noexcept;
+    PersistentSingleLinkedList& operator=(PersistentSingleLinkedList&& rhs) noexcept;
+
+    // Закрывает файл. Элементы остаются в файле
+    ~PersistentSingleLinkedList();
+
+    void swap(PersistentSingleLinkedList& other) noexcept;
+
+    /*
+     * Вставляет копию value после элемента, на который указывает pos, и возвращает итератор на неё.
+     * Если при увеличении файла будет выброшено исключение, список останется в прежнем состоянии
+     */
+    Iterator InsertAfter(ConstIterator pos, const Type& value);
+
+    void PushFront(const Type& value);
+
+    // Удаляет элемент, следующий за pos, и возвращает итератор на следующий за ним элемент
+    Iterator EraseAfter(ConstIterator pos);
+
+    // Удаляет первый элемент непустого списка
+    void PopFront();
+
+    [[nodiscard]] Type& Front();
+    [[nodiscard]] const Type& Front() const noexcept;
+
+    // Удаляет все элементы за время O(1). Размер файла не уменьшается
+    void Clear();
+
+    // Увеличивает файл так, чтобы count новых элементов поместились без повторного отображения
+    void Reserve(size_t count);
+
+    // Синхронно записывает изменения на диск
+    void Sync();
+
+    [[nodiscard]] size_t GetSize() const noexcept;
+
+    [[nodiscard]] bool IsEmpty() const noexcept;
+
+    [[nodiscard]] bool IsReadOnly() const noexcept;
+
+private:
+    [[nodiscard]] Header& GetHeader() noexcept;
+    [[nodiscard]] const Header& GetHeader() const noexcept;
+
+    [[nodiscard]] Link& LinkAt(Offset offset) noexcept;
+    [[nodiscard]] Node& NodeAt(Offset offset) noexcept;
+
+    // Проверяет, что файл открыт для записи
+    void CheckWritable() const;
+
+    // Выделяет место под узел и возвращает его смещение. Может заново отобразить файл
+    Offset AllocateNode();
+
+    // Увеличивает файл до file_size байт и отображает его заново
+    void Grow(size_t file_size);
+
+    void Map(size_t file_size);
+
+    // Закрывает отображение и файл
+    void Close() noexcept;
+
+    [[noreturn]] static void ThrowSystemError(const char* what);
+
+    int fd_ = -1;
+    std::byte* base_ = nullptr;
+    size_t file_size_ = 0;
+    bool read_only_ = true;
+};
+
+template <typename Type>
+PersistentSingleLinkedList<Type>::PersistentSingleLinkedList(const std::string& path, PersistentOpenMode mode)
+    : read_only_(mode == PersistentOpenMode::ReadOnly) {
+    fd_ = read_only_ ? ::open(path.c_str(), O_RDONLY | O_CLOEXEC) : ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (fd_ < 0) {
+        ThrowSystemError("PersistentSingleLinkedList: open");
+    }
+    try {
+        struct stat info = {};
+        if (::fstat(fd_, &info) != 0) {
+            ThrowSystemError("PersistentSingleLinkedList: fstat");
+        }
+        const auto file_size = static_cast<size_t>(info.st_size);
+        if (file_size == 0 && !read_only_) {
+            // Новый файл: записываем заголовок пустого списка
+            Grow(MIN_FILE_SIZE);
+            Header& header = *::new (base_) Header{};
+            header.magic = MAGIC;
+            header.version = VERSION;
+            header.value_size = sizeof(Type);
+            header.value_align = alignof(Type);
+            header.node_size = sizeof(Node);
+            header.used = FIRST_NODE_OFFSET;
+            return;
+        }
+        if (file_size < sizeof(Header)) {
+            throw std::runtime_error("PersistentSingleLinkedList: file is too small");
+        }
+        Map(file_size);
+        const Header& header = GetHeader();
+        if (header.magic != MAGIC || header.version != VERSION) {
+            throw std::runtime_error("PersistentSingleLinkedList: not a list file");
+        }
+        if (header.value_size != sizeof(Type) || header.value_align != alignof(Type) || header.node_size != sizeof(Node)) {
+            throw std::runtime_error("PersistentSingleLinkedList: file was written for another element type");
+        }
+        if (header.used > file_size_) {
+            throw std::runtime_error("PersistentSingleLinkedList: file is truncated");
+        }
+    } catch (...) {
+        Close();
+        throw;
+    }
+}
+
+template <typename Type>
+PersistentSingleLinkedList<Type>::PersistentSingleLinkedList(PersistentSingleLinkedList&& other) noexcept {
+    swap(other);
+}
+
+template <typename Type>
+PersistentSingleLinkedList<Type>& PersistentSingleLinkedList<Type>::operator=(PersistentSingleLinkedList&& rhs) noexcept {
+    if (this != &rhs) {
+        Close();
+        swap(rhs);
+    }
+    return *this;
+}
+
+template <typename Type>
+PersistentSingleLinkedList<Type>::~PersistentSingleLinkedList() {
+    Close();
+}
+
+template <typename Type>
+void PersistentSingleLinkedList<Type>::swap(PersistentSingleLinkedList& other) noexcept {
+    std::swap(fd_, other.fd_);
+    std::swap(base_, other.base_);
+    std::swap(file_size_, other.file_size_);
+    std::swap(read_only_, other.read_only_);
+}
+
+template <typename Type>
+typename PersistentSingleLinkedList<Type>::Iterator PersistentSingleLinkedList<Type>::InsertAfter(
+    ConstIterator pos, const Type& value) {
+    CheckWritable();
+    assert(pos.offset_ != 0);
+    // Файл может быть отображён заново, поэтому позиция запоминается смещением,
+    // а значение копируется заранее: value может оказаться элементом этого же списка
+    const Offset prev = pos.offset_;
+    const Type copy = value;
+    const Offset offset = AllocateNode();
+    Node& node = NodeAt(offset);
+    ::new (static_cast<void*>(&node.value)) Type(copy);
+    node.next = LinkAt(prev).next;
+    LinkAt(prev).next = offset;
+    ++GetHeader().size;
+    return Iterator{base_, offset};
+}
+
+template <typename Type>
+void PersistentSingleLinkedList<Type>::PushFront(const Type& value) {
+    InsertAfter(cbefore_begin(), value);
+}
+
+template <typename Type>
+typename PersistentSingleLinkedList<Type>::Iterator PersistentSingleLinkedList<Type>::EraseAfter(ConstIterator pos) {
+    CheckWritable();
+    assert(pos.offset_ != 0);
+    Link& prev = LinkAt(pos.offset_);
+    const Offset erased = prev.next;
+    assert(erased != 0);
+    Header& header = GetHeader();
+    prev.next = LinkAt(erased).next;
+    LinkAt(erased).next = header.free_list;
+    header.free_list = erased;
+    --header.size;
+    return Iterator{base_, prev.next};
+}
+
+template <typename Type>
+void PersistentSingleLinkedList<Type>::PopFront() {
+    assert(!IsEmpty());
+    EraseAfter(cbefore_begin());
+}
+
+template <typename Type>
+Type& PersistentSingleLinkedList<Type>::Front() {
+    CheckWritable();
+    assert(!IsEmpty());
+    return NodeAt(GetHeader().head.next).value;
+}
+
+template <typename Type>
+const Type& PersistentSingleLinkedList<Type>::Front() const noexcept {
+    assert(!IsEmpty());
+    return *cbegin();
+}
+
+template <typename Type>
+void PersistentSingleLinkedList<Type>::Clear() {
+    CheckWritable();
+    // Элементы тривиально разрушаемы, поэтому вся область узлов просто объявляется свободной
+    Header& header = GetHeader();
+    header.head.next = 0;
+    header.free_list = 0;
+    header.used = FIRST_NODE_OFFSET;
+    header.size = 0;
+}
+
+template <typename Type>
+void PersistentSingleLinkedList<Type>::Reserve(size_t count) {
+    CheckWritable();
+    const Offset used = GetHeader().used;
+    if (count > (SIZE_MAX - used) / sizeof(Node)) {
+        throw std::length_error("PersistentSingleLinkedList: capacity overflow");
+    }
+    const size_t required = used + count * sizeof(Node);
+    if (required > file_size_) {
+        Grow(required);
+    }
+}
+
+template <typename Type>
+void PersistentSingleLinkedList<Type>::Sync() {
+    if (!read_only_ && ::msync(base_, file_size_, MS_SYNC) != 0) {
+        ThrowSystemError("PersistentSingleLinkedList: msync");
+    }
+}
+
+template <typename Type>
+size_t PersistentSingleLinkedList<Type>::GetSize() const noexcept {
+    return static_cast<size_t>(GetHeader().size);
+}
+
+template <typename Type>
+bool PersistentSingleLinkedList<Type>::IsEmpty() const noexcept {
+    return GetHeader().size == 0;
+}
+
+template <typename Type>
+bool PersistentSingleLinkedList<Type>::IsReadOnly() const noexcept {
+    return read_only_;
+}
+
+template <typename Type>
+typename PersistentSingleLinkedList<Type>::Header& PersistentSingleLinkedList<Type>::GetHeader() noexcept {
+    return *std::launder(reinterpret_cast<Header*>(base_));
+}
+
+template <typename Type>
+const typename PersistentSingleLinkedList<Type>::Header& PersistentSingleLinkedList<Type>::GetHeader() const noexcept {
+    return *std::launder(reinterpret_cast<const Header*>(base_));
+}
+
+template <typename Type>
+typename PersistentSingleLinkedList<Type>::Link& PersistentSingleLinkedList<Type>::LinkAt(Offset offset) noexcept {
+    assert(offset != 0 && offset < file_size_);
+    return *reinterpret_cast<Link*>(base_ + offset);
+}
+
+template <typename Type>
+typename PersistentSingleLinkedList<Type>::Node& PersistentSingleLinkedList<Type>::NodeAt(Offset offset) noexcept {
+    assert(offset >= FIRST_NODE_OFFSET && offset + sizeof(Node) <= file_size_);
+    return *reinterpret_cast<Node*>(base_ + offset);
+}
+
+template <typename Type>
+void PersistentSingleLinkedList<Type>::CheckWritable() const {
+    if (read_only_) {
+        throw std::logic_error("PersistentSingleLinkedList: list is opened read-only");
+    }
+}
+
+template <typename Type>
+typename PersistentSingleLinkedList<Type>::Offset PersistentSingleLinkedList<Type>::AllocateNode() {
+    Header* header = &GetHeader();
+    if (header->free_list != 0) {
+        const Offset offset = header->free_list;
+        header->free_list = LinkAt(offset).next;
+        return offset;
+    }
+    if (header->used + sizeof(Node) > file_size_) {
+        Grow(std::max(file_size_ * 2, static_cast<size_t>(header->used + sizeof(Node))));
+        header = &GetHeader();
+    }
+    const Offset offset = header->used;
+    header->used += sizeof(Node);
+    return offset;
+}
+
+template <typename Type>
+void PersistentSingleLinkedList<Type>::Grow(size_t file_size) {
+    file_size = std::max(file_size, MIN_FILE_SIZE);
+    if (::ftruncate(fd_, static_cast<off_t>(file_size)) != 0) {
+        ThrowSystemError("PersistentSingleLinkedList: ftruncate");
+    }
+    Map(file_size);
+}
+
+template <typename Type>
+void PersistentSingleLinkedList<Type>::Map(size_t file_size) {
+    const int protection = read_only_ ? PROT_READ : PROT_READ | PROT_WRITE;
+    void* memory = ::mmap(nullptr, file_size, protection, MAP_SHARED, fd_, 0);
+    if (memory == MAP_FAILED) {
+        ThrowSystemError("PersistentSingleLinkedList: mmap");
+    }
+    // Старое отображение освобождается только после успешного создания нового
+    if (base_ != nullptr) {
+        ::munmap(base_, file_size_);
+    }
+    base_ = static_cast<std::byte*>(memory);
+    file_size_ = file_size;
+}
+
+template <typename Type>
+void PersistentSingleLinkedList<Type>::Close() noexcept {
+    if (base_ != nullptr) {
+        ::munmap(base_, file_size_);
+        base_ = nullptr;
+        file_size_ = 0;
+    }
+    if (fd_ >= 0) {
+        ::close(fd_);
+        fd_ = -1;
+    }
+}
+
+template <typename Type>
+void PersistentSingleLinkedList<Type>::ThrowSystemError(const char* what) {
+    throw std::system_error(errno, std::generic_category(), what);
+}
+
+template <typename Type>
+void swap(PersistentSingleLinkedList<Type>& lhs, PersistentSingleLinkedList<Type>& rhs) noexcept {
+    lhs.swap(rhs);
+}
@@ -1,25 +1,213 @@
 #pragma once
 
+#include "list-statistics.h"
+
 #include <cassert>
 #include <cstddef>
 #include <iterator>
 #include <utility>
 #include <algorithm>
+#include <functional>
 #include <initializer_list>
-#include <stack>
+#include <memory>
+#include <type_traits>
+#include <exception>
+#include <optional>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <new>
+#include <limits>
+#if __cplusplus > 201703L
+#include <compare>
+#include <concepts>
+#include <ranges>
+#endif
+
+// Политика по умолчанию: список не хранит указатель на последний узел и не тратит на него память
+struct NoTailTracking {};
+
+// Список хранит указатель на последний узел, что позволяет добавлять элементы в конец за время O(1)
+struct TailTracking {};
+
+// Политика по умолчанию: память удалённых узлов сразу возвращается аллокатору
+struct NoNodeReserve {};
+
+// Список хранит запас свободных узлов (см. Reserve): вставка берёт память из запаса,
+// а удаление возвращает её туда, не обращаясь к аллокатору
+struct NodeReserve {};
+
+// Политика по умолчанию: список не хранит отпечаток содержимого, GetHash обходит все элементы
+struct NoFingerprint {};
+
+// Список хранит отпечаток содержимого - полиномиальный хеш элементов (см. GetHash).
+// PushFront, PopFront, PushBack, а также вставка и удаление в начале списка обновляют отпечаток
+// за время O(1), остальные изменения помечают его устаревшим, и он пересчитывается при следующем обращении.
+// Разные отпечатки позволяют operator== вернуть false, не обходя списки.
+// Чтобы отпечаток не расходился с содержимым, элементы такого списка доступны только для чтения
+struct IncrementalFingerprint {};
+
+// Политика по умолчанию: поиск позиции и значения идёт от начала списка
+struct NoSkipIndex {};
 
-template <typename Type>
+/*
+ * Список хранит индекс: делит узлы на участки длиной порядка sqrt(N), и каждый узел знает свой участок.
+ * At, Advance и LowerBound пропускают участки целиком и выполняются за время O(sqrt(N)),
+ * LowerBound в отсортированном списке ищет участок двоичным поиском.
+ * Вставка и удаление одного элемента (InsertAfter, EraseAfter, PushFront, PopFront, PushBack)
+ * обновляют индекс за амортизированное время O(1): участок, выросший вдвое, делится за время O(sqrt(N)),
+ * а когда участков становится вдвое больше 2·sqrt(N), вставка перестраивает индекс за время O(N)
+ * под новый размер. Остальные изменения помечают индекс устаревшим, и он перестраивается
+ * за время O(N) при следующем поиске. Каждый узел занимает на указатель больше
+ */
+struct SkipIndex {};
+
+// Сообщает, умеет ли аллокатор освобождать всю свою память целиком (см. ArenaAllocator)
+template <typename Alloc, typename = void>
+inline constexpr bool SUPPORTS_BULK_RELEASE = false;
+
+template <typename Alloc>
+inline constexpr bool SUPPORTS_BULK_RELEASE<Alloc, std::void_t<
+    decltype(std::declval<Alloc&>().ReleaseAll(size_t{})),
+    decltype(std::declval<Alloc&>().ReleaseAllAsync(size_t{}))>> = true;
+
+template <typename Type, typename Allocator = std::allocator<Type>, typename TailPolicy = NoTailTracking,
+          typename StatsPolicy = NoListStatistics, typename ReservePolicy = NoNodeReserve,
+          typename FingerprintPolicy = NoFingerprint, typename IndexPolicy = NoSkipIndex>
 class SingleLinkedList {
+    struct Node;
+    struct IndexSegment;
+
+    static constexpr bool MAINTAINS_SKIP_INDEX = std::is_same_v<IndexPolicy, SkipIndex>;
+    static_assert(MAINTAINS_SKIP_INDEX || std::is_same_v<IndexPolicy, NoSkipIndex>,
+                  "IndexPolicy must be NoSkipIndex or SkipIndex");
+
+    // Указатель узла на его участок индекса либо пустая заглушка, если индекса нет
+    struct NoSegmentLink {};
+    using SegmentLink = std::conditional_t<MAINTAINS_SKIP_INDEX, IndexSegment*, NoSegmentLink>;
+
+    // Базовая часть узла, хранящая только указатель на следующий узел.
+    // Фиктивный узел head_ не содержит значения, поэтому Type не обязан
+    // иметь конструктор по умолчанию
+    struct NodeBase {
+        Node* next_node = nullptr;
+    };
+
     // Узел списка
-    struct Node {
-        Node() = default;
-        Node(const Type& val, Node* next)
-            : value(val)
-            , next_node(next) {
+    struct Node : NodeBase {
+        // Конструирует значение узла на месте из аргументов args
+        template <typename... Args>
+        Node(std::in_place_t, Node* next, Args&&... args)
+            : NodeBase{next}
+            , value(std::forward<Args>(args)...) {
         }
         Type value;
-        Node* next_node = nullptr;
+        [[no_unique_address]] SegmentLink segment = {};
+    };
+
+    // Цепочка узлов, ещё не присоединённая к списку
+    struct Chain {
+        Node* first = nullptr;
+        Node* last = nullptr;
+        size_t size = 0;
+    };
+
+    // Разрешает шаблон только для типов, являющихся итераторами ввода
+    template <typename It>
+    using EnableIfInputIterator = std::enable_if_t<std::is_convertible_v<
+        typename std::iterator_traits<It>::iterator_category, std::input_iterator_tag>>;
+
+    // Аллокатор узлов, полученный из Allocator при помощи rebind
+    using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    using NodeAllocTraits = std::allocator_traits<NodeAllocator>;
+
+    static constexpr bool TRACKS_TAIL = std::is_same_v<TailPolicy, TailTracking>;
+    static_assert(TRACKS_TAIL || std::is_same_v<TailPolicy, NoTailTracking>,
+                  "TailPolicy must be NoTailTracking or TailTracking");
+
+    // Указатель на последний узел либо пустая заглушка, если хвост не отслеживается
+    struct NoTail {};
+    using TailPointer = std::conditional_t<TRACKS_TAIL, Node*, NoTail>;
+
+    static constexpr bool COLLECTS_STATISTICS = std::is_same_v<StatsPolicy, CollectListStatistics>;
+    static_assert(COLLECTS_STATISTICS || std::is_same_v<StatsPolicy, NoListStatistics>,
+                  "StatsPolicy must be NoListStatistics or CollectListStatistics");
+
+    // Статистика списка либо пустая заглушка, если статистика не собирается.
+    // Итераторы не ссылаются на статистику: их узлы могут перейти в другой список
+    // (SpliceAfter, SplitAfter, перемещение), который переживёт исходный
+    using Statistics = std::conditional_t<COLLECTS_STATISTICS, ListStatistics, NoListStatistics>;
+
+    static constexpr bool RESERVES_NODES = std::is_same_v<ReservePolicy, NodeReserve>;
+    static_assert(RESERVES_NODES || std::is_same_v<ReservePolicy, NoNodeReserve>,
+                  "ReservePolicy must be NoNodeReserve or NodeReserve");
+
+    // Свободная память узла из запаса. Хранит только указатель на следующий свободный узел
+    struct SpareNode {
+        Node* next = nullptr;
+    };
+
+    // Запас свободных узлов: односвязный список сырой памяти узлов без значений
+    struct SpareNodes {
+        Node* first = nullptr;
+        size_t count = 0;
+        // Наибольшее число узлов, которое запас хранит, вместо того чтобы освобождать их
+        size_t limit = 0;
     };
+    struct NoSpareNodes {};
+    using Spares = std::conditional_t<RESERVES_NODES, SpareNodes, NoSpareNodes>;
+
+    static constexpr bool MAINTAINS_FINGERPRINT = std::is_same_v<FingerprintPolicy, IncrementalFingerprint>;
+    static_assert(MAINTAINS_FINGERPRINT || std::is_same_v<FingerprintPolicy, NoFingerprint>,
+                  "FingerprintPolicy must be NoFingerprint or IncrementalFingerprint");
+
+    // Отпечаток списка x0, x1, ..., x(n-1): hash = h(x0)·B^(n-1) + h(x1)·B^(n-2) + ... + h(x(n-1))
+    // по модулю 2^64 и power = B^n. Вставка в начало прибавляет h(x)·B^n, удаление первого элемента
+    // вычитает h(x0)·B^(n-1), вставка в конец вычисляет hash·B + h(x)
+    struct Fingerprint {
+        std::uint64_t hash = 0;
+        std::uint64_t power = 1;
+        bool is_valid = true;
+    };
+    struct NoFingerprintState {};
+    using FingerprintState = std::conditional_t<MAINTAINS_FINGERPRINT, Fingerprint, NoFingerprintState>;
+
+    // Основание полиномиального хеша нечётно и потому обратимо по модулю 2^64
+    static constexpr std::uint64_t FINGERPRINT_BASE = 0x9E3779B97F4A7C15ull;
+    // Обратный элемент находится методом Ньютона: каждая итерация удваивает число верных битов
+    static constexpr std::uint64_t FINGERPRINT_BASE_INVERSE = [] {
+        std::uint64_t inverse = FINGERPRINT_BASE;
+        for (int i = 0; i < 5; ++i) {
+            inverse *= 2 - FINGERPRINT_BASE * inverse;
+        }
+        return inverse;
+    }();
+    static_assert(FINGERPRINT_BASE * FINGERPRINT_BASE_INVERSE == 1);
+
+    // Короткие участки обходятся быстрее, чем поиск по индексу
+    static constexpr size_t MIN_INDEX_SEGMENT_SIZE = 16;
+
+    // Участок индекса: count подряд идущих узлов, начиная с first. index - номер участка в индексе
+    struct IndexSegment {
+        Node* first = nullptr;
+        size_t count = 0;
+        size_t index = 0;
+    };
+
+    // Индекс делит список на участки не длиннее 2·segment_size узлов. Участки лежат в куче,
+    // чтобы указатели узлов на них не менялись при вставке и удалении участков
+    struct SkipIndexData {
+        std::vector<std::unique_ptr<IndexSegment>> segments;
+        size_t segment_size = MIN_INDEX_SEGMENT_SIZE;
+        bool is_valid = true;
+    };
+    struct NoSkipIndexData {};
+    using SkipIndexState = std::conditional_t<MAINTAINS_SKIP_INDEX, SkipIndexData, NoSkipIndexData>;
     
     // Шаблон класса «Базовый Итератор».
     // Определяет поведение итератора на элементы односвязного списка
@@ -31,7 +219,7 @@ class SingleLinkedList {
         friend class SingleLinkedList;
 
         // Конвертирующий конструктор итератора из указателя на узел списка
-        explicit BasicIterator(Node* node) : node_(node)
+        explicit BasicIterator(NodeBase* node) : node_(node)
         {}
 
     public:
@@ -87,12 +275,21 @@ class SingleLinkedList {
             return !(node_ == rhs.node_);
         }
 
+#if __cplusplus > 201703L
+        // Сравнение с std::default_sentinel: итератор достиг конца, если он указывает на end().
+        // Позволяет использовать список в алгоритмах с парой итератор/страж, не вызывая end()
+        [[nodiscard]] bool operator==(std::default_sentinel_t) const noexcept {
+            return node_ == nullptr;
+        }
+#endif
+
         // Оператор прединкремента. После его вызова итератор указывает на следующий элемент списка
         // Возвращает ссылку на самого себя
         // Инкремент итератора, не указывающего на существующий элемент списка, приводит к неопределённому поведению
+        // Проверка выполняется только в отладочной сборке, чтобы в цикле обхода оставалась одна загрузка next_node
         BasicIterator& operator++() noexcept {
-            if(node_ != nullptr)
-                node_ = node_->next_node;
+            assert(node_ != nullptr);
+            node_ = node_->next_node;
             return *this;
         }
 
@@ -111,7 +308,7 @@ class SingleLinkedList {
         // приводит к неопределённому поведению
         [[nodiscard]] reference operator*() const noexcept {
             assert (node_ != nullptr);
-            return node_->value;
+            return static_cast<Node*>(node_)->value;
         }
 
         // Операция доступа к члену класса. Возвращает указатель на текущий элемент списка
@@ -119,27 +316,166 @@ class SingleLinkedList {
         // приводит к неопределённому поведению
         [[nodiscard]] pointer operator->() const noexcept {
             assert (node_ != nullptr);
-            return &node_->value;
+            return &static_cast<Node*>(node_)->value;
         }
 
     private:
-        Node* node_ = nullptr;
+        NodeBase* node_ = nullptr;
     };
 
 public:
     using value_type = Type;
     using reference = value_type&;
     using const_reference = const value_type&;
+    using allocator_type = Allocator;
 
-    // Итератор, допускающий изменение элементов списка
-    using Iterator = BasicIterator<Type>;
+    // Итератор, допускающий изменение элементов списка.
+    // При политике IncrementalFingerprint элементы доступны только для чтения, и Iterator совпадает с ConstIterator
+    using Iterator = std::conditional_t<MAINTAINS_FINGERPRINT, BasicIterator<const Type>, BasicIterator<Type>>;
     // Константный итератор, предоставляющий доступ для чтения к элементам списка
     using ConstIterator = BasicIterator<const Type>;
+    // Ссылка на элемент, которую возвращают EmplaceFront, EmplaceBack и Back
+    using ElementReference = std::conditional_t<MAINTAINS_FINGERPRINT, const Type&, Type&>;
+
+    /*
+     * Потоковое чтение списка в формате Serialize: байты можно передавать порциями
+     * любого размера по мере их поступления, полностью полученные элементы сразу
+     * добавляются в конец списка. Пока идёт чтение, список можно читать,
+     * но нельзя изменять иначе как через Feed
+     */
+    class Deserializer {
+    public:
+        // Элементы будут добавляться после последнего элемента list
+        explicit Deserializer(SingleLinkedList& list) noexcept;
+
+        /*
+         * Принимает очередную порцию байт и возвращает количество использованных байт.
+         * Байты после конца сериализованного списка не используются.
+         * Если выделение памяти завершится исключением, уже полученные элементы останутся в списке
+         */
+        size_t Feed(const void* data, size_t size);
+
+        // Сообщает, получены ли все элементы
+        [[nodiscard]] bool IsComplete() const noexcept;
+
+        // Количество байт, которых заведомо не хватает до конца сериализованного списка
+        [[nodiscard]] size_t GetMissingBytes() const noexcept;
+
+    private:
+        static constexpr size_t PENDING_SIZE = std::max(sizeof(std::uint64_t), sizeof(Type));
+
+        // Дописывает в pending_ не более чем до need байт и возвращает количество использованных байт
+        size_t FillPending(const unsigned char* data, size_t size, size_t need) noexcept;
+
+        SingleLinkedList* list_;
+        NodeBase* last_;
+        // Начало заголовка или элемента, разрезанного между порциями
+        unsigned char pending_[PENDING_SIZE] = {};
+        size_t pending_size_ = 0;
+        bool has_header_ = false;
+        std::uint64_t remaining_ = 0;
+    };
+
+    /*
+     * Диапазон элементов списка, итераторы которого учитывают свои инкременты в статистике списка
+     * (см. Counted). Итераторы диапазона ссылаются на статистику списка, поэтому пользоваться ими
+     * можно, только пока список существует. Переходы по узлам, перенесённым в другой список,
+     * учитываются в статистике исходного.
+     * ValueType — совпадает с Type либо с const Type
+     */
+    template <typename ValueType>
+    class CountedRange
+#if __cplusplus > 201703L
+        : public std::ranges::view_base
+#endif
+    {
+        friend class SingleLinkedList;
+
+    public:
+        // Итератор диапазона. Каждый инкремент учитывается в статистике списка
+        class CountingIterator {
+            friend class CountedRange;
+
+            CountingIterator(NodeBase* node, ListStatistics* statistics) noexcept
+                : node_(node)
+                , statistics_(statistics) {
+            }
+
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = Type;
+            using difference_type = std::ptrdiff_t;
+            using pointer = ValueType*;
+            using reference = ValueType&;
+
+            CountingIterator() = default;
+
+            [[nodiscard]] bool operator==(const CountingIterator& rhs) const noexcept {
+                return node_ == rhs.node_;
+            }
+
+            [[nodiscard]] bool operator!=(const CountingIterator& rhs) const noexcept {
+                return node_ != rhs.node_;
+            }
+
+            // Инкремент итератора, не указывающего на существующий элемент списка, приводит к неопределённому поведению
+            CountingIterator& operator++() noexcept {
+                assert(node_ != nullptr);
+                node_ = node_->next_node;
+                statistics_->OnIncrement();
+                return *this;
+            }
+
+            CountingIterator operator++(int) noexcept {
+                auto old_it(*this);
+                ++(*this);
+                return old_it;
+            }
+
+            [[nodiscard]] reference operator*() const noexcept {
+                assert(node_ != nullptr);
+                return static_cast<Node*>(node_)->value;
+            }
+
+            [[nodiscard]] pointer operator->() const noexcept {
+                assert(node_ != nullptr);
+                return &static_cast<Node*>(node_)->value;
+            }
+
+        private:
+            NodeBase* node_ = nullptr;
+            ListStatistics* statistics_ = nullptr;
+        };
+
+        CountedRange() = default;
+
+        [[nodiscard]] CountingIterator begin() const noexcept {
+            return CountingIterator{first_, statistics_};
+        }
+
+        [[nodiscard]] CountingIterator end() const noexcept {
+            return CountingIterator{nullptr, statistics_};
+        }
+
+    private:
+        CountedRange(NodeBase* first, ListStatistics* statistics) noexcept
+            : first_(first)
+            , statistics_(statistics) {
+        }
+
+        NodeBase* first_ = nullptr;
+        ListStatistics* statistics_ = nullptr;
+    };
+
+    // Учитываемый обход элементов списка. Как и у Iterator, при политике IncrementalFingerprint элементы
+    // доступны только для чтения
+    using CountedView = CountedRange<std::conditional_t<MAINTAINS_FINGERPRINT, const Type, Type>>;
+    using ConstCountedView = CountedRange<const Type>;
 
     // Возвращает итератор, ссылающийся на первый элемент
     // Если список пустой, возвращённый итератор будет равен end()
     [[nodiscard]] Iterator begin() noexcept {
-        return Iterator{head_.next_node};
+        return MakeIterator(head_.next_node);
     }
 
     // Возвращает итератор, указывающий на позицию, следующую за последним элементом односвязного списка
@@ -152,7 +488,7 @@ public:
     // Если список пустой, возвращённый итератор будет равен end()
     // Результат вызова эквивалентен вызову метода cbegin()
     [[nodiscard]] ConstIterator begin() const noexcept {
-        return ConstIterator{head_.next_node};
+        return MakeConstIterator(head_.next_node);
     }
 
     // Возвращает константный итератор, указывающий на позицию, следующую за последним элементом односвязного списка
@@ -165,7 +501,7 @@ public:
     // Возвращает константный итератор, ссылающийся на первый элемент
     // Если список пустой, возвращённый итератор будет равен cend()
     [[nodiscard]] ConstIterator cbegin() const noexcept {
-        return ConstIterator{head_.next_node};
+        return MakeConstIterator(head_.next_node);
     }
 
     // Возвращает константный итератор, указывающий на позицию, следующую за последним элементом односвязного списка
@@ -177,19 +513,19 @@ public:
     // Возвращает итератор, указывающий на позицию перед первым элементом односвязного списка.
     // Разыменовывать этот итератор нельзя - попытка разыменования приведёт к неопределённому поведению
     [[nodiscard]] Iterator before_begin() noexcept {
-        return Iterator{&head_};
+        return MakeIterator(&head_);
     }
 
     // Возвращает константный итератор, указывающий на позицию перед первым элементом односвязного списка.
     // Разыменовывать этот итератор нельзя - попытка разыменования приведёт к неопределённому поведению
     [[nodiscard]] ConstIterator cbefore_begin() const noexcept {
-        return ConstIterator{const_cast<Node*>(&head_)};
+        return MakeConstIterator(&head_);
     }
 
     // Возвращает константный итератор, указывающий на позицию перед первым элементом односвязного списка.
     // Разыменовывать этот итератор нельзя - попытка разыменования приведёт к неопределённому поведению
     [[nodiscard]] ConstIterator before_begin() const noexcept {
-        return ConstIterator{&head_};
+        return MakeConstIterator(&head_);
     }
     
     /*
@@ -199,22 +535,124 @@ public:
      */
     Iterator InsertAfter(ConstIterator pos, const Type& value);
 
+    // Вставляет элемент value после pos, перемещая его. Гарантии те же, что у InsertAfter
+    Iterator InsertAfter(ConstIterator pos, Type&& value);
+
+    /*
+     * Конструирует элемент на месте из аргументов args после элемента, на который указывает pos.
+     * Возвращает итератор на вставленный элемент
+     * Если при создании элемента будет выброшено исключение, список останется в прежнем состоянии
+     */
+    template <typename... Args>
+    Iterator EmplaceAfter(ConstIterator pos, Args&&... args);
+
+    /*
+     * Вставляет count копий value после элемента, на который указывает pos.
+     * Цепочка новых узлов строится отдельно и присоединяется к списку одной записью указателя.
+     * Возвращает итератор на последний вставленный элемент либо pos, если count == 0
+     * Если при создании элемента будет выброшено исключение, список останется в прежнем состоянии
+     */
+    Iterator InsertAfter(ConstIterator pos, size_t count, const Type& value);
+
+    /*
+     * Вставляет элементы диапазона [first, last) после элемента, на который указывает pos.
+     * Гарантии и возвращаемое значение те же, что у InsertAfter(pos, count, value)
+     */
+    template <typename It, typename = EnableIfInputIterator<It>>
+    Iterator InsertAfter(ConstIterator pos, It first, It last);
+
+    Iterator InsertAfter(ConstIterator pos, std::initializer_list<Type> values);
+
     /*
      * Удаляет элемент, следующий за pos.
      * Возвращает итератор на элемент, следующий за удалённым
      */
     Iterator EraseAfter(ConstIterator pos) noexcept;
 
+    /*
+     * Удаляет элементы из интервала (first, last).
+     * Узлы отсоединяются от списка одной записью указателя и затем освобождаются.
+     * Возвращает итератор last
+     */
+    Iterator EraseAfter(ConstIterator first, ConstIterator last) noexcept;
+
+    /*
+     * Переносит все элементы other в текущий список после pos без копирования элементов.
+     * other становится пустым. Выполняется за время O(1), если other отслеживает хвост,
+     * и за O(M), где M - размер other, в противном случае. Аллокаторы списков должны быть равны
+     */
+    void SpliceAfter(ConstIterator pos, SingleLinkedList& other) noexcept;
+    void SpliceAfter(ConstIterator pos, SingleLinkedList&& other) noexcept;
+
+    // Переносит элемент other, следующий за it, в текущий список после pos за время O(1)
+    void SpliceAfter(ConstIterator pos, SingleLinkedList& other, ConstIterator it) noexcept;
+    void SpliceAfter(ConstIterator pos, SingleLinkedList&& other, ConstIterator it) noexcept;
+
+    /*
+     * Переносит элементы other из интервала (first, last) в текущий список после pos
+     * за время O(K), где K - число переносимых элементов (нужно для подсчёта размера).
+     * pos не должен находиться внутри интервала
+     */
+    void SpliceAfter(ConstIterator pos, SingleLinkedList& other, ConstIterator first, ConstIterator last) noexcept;
+    void SpliceAfter(ConstIterator pos, SingleLinkedList&& other, ConstIterator first, ConstIterator last) noexcept;
+
     void PopFront() noexcept;
 
+    /*
+     * Удаляет из начала списка min(count, GetSize()) элементов за один проход,
+     * перемещая их значения по порядку в out. Возвращает итератор за последним записанным значением.
+     * Голова списка, размер и статистика обновляются один раз в конце. out не должен ссылаться на этот список.
+     * Если запись в out выбросит исключение, из списка будут удалены только уже перемещённые элементы
+     */
+    template <typename OutputIt>
+    OutputIt PopFrontN(size_t count, OutputIt out);
+
     SingleLinkedList() = default;
-    
-    SingleLinkedList(std::initializer_list<Type> values);
+
+    explicit SingleLinkedList(const Allocator& alloc) noexcept;
+
+    SingleLinkedList(std::initializer_list<Type> values, const Allocator& alloc = Allocator());
+
+    // Создаёт список из элементов диапазона [first, last) за один проход
+    template <typename It, typename = EnableIfInputIterator<It>>
+    SingleLinkedList(It first, It last, const Allocator& alloc = Allocator());
+
+#if __cplusplus > 201703L
+    /*
+     * Создаёт список из элементов диапазона range за один проход, добавляя узлы в конец.
+     * range может быть ленивым представлением (std::views::filter, std::views::transform и т.п.)
+     * с итератором и стражем разных типов: промежуточные копии не создаются.
+     * Если при создании элемента будет выброшено исключение, созданные узлы удаляются
+     */
+    template <std::ranges::input_range Range>
+        requires std::constructible_from<Type, std::ranges::range_reference_t<Range>>
+    [[nodiscard]] static SingleLinkedList FromRange(Range&& range, const Allocator& alloc = Allocator());
+#endif
 
     SingleLinkedList(const SingleLinkedList& other);
 
+    // Перемещающий конструктор забирает узлы other за время O(1), other становится пустым
+    SingleLinkedList(SingleLinkedList&& other) noexcept;
+
     SingleLinkedList& operator=(const SingleLinkedList& rhs);
 
+    // Перемещающее присваивание за время O(N), где N - размер текущего списка.
+    // Если аллокаторы нельзя передать и они не равны, элементы rhs перемещаются поэлементно
+    SingleLinkedList& operator=(SingleLinkedList&& rhs) noexcept(
+        NodeAllocTraits::propagate_on_container_move_assignment::value || NodeAllocTraits::is_always_equal::value);
+
+    /*
+     * Заменяет содержимое списка элементами диапазона [first, last).
+     * Существующие узлы используются повторно: их значения перезаписываются присваиванием,
+     * недостающие узлы создаются, лишние удаляются.
+     * Если при присваивании или создании элемента будет выброшено исключение,
+     * список останется в корректном, но неопределённом состоянии
+     */
+    template <typename It, typename = EnableIfInputIterator<It>>
+    void Assign(It first, It last);
+
+    void Assign(std::initializer_list<Type> values);
+
     // Обменивает содержимое списков за время O(1)
     void swap(SingleLinkedList& other) noexcept;
 
@@ -223,171 +661,2626 @@ public:
     // Вставляет элемент value в начало списка за время O(1)
     void PushFront(const Type& value);
 
-    // Очищает список за время O(N)
-    void Clear() noexcept;
+    // Вставляет элемент value в начало списка за время O(1), перемещая его
+    void PushFront(Type&& value);
 
-    // Возвращает количество элементов в списке за время O(1)
-    [[nodiscard]] size_t GetSize() const noexcept;
+    // Конструирует элемент в начале списка из аргументов args за время O(1)
+    // Возвращает ссылку на вставленный элемент
+    template <typename... Args>
+    ElementReference EmplaceFront(Args&&... args);
 
-    // Сообщает, пустой ли список за время O(1)
-    [[nodiscard]] bool IsEmpty() const noexcept;
+    /*
+     * Вставляет элементы диапазона [first, last) в начало списка, сохраняя их порядок.
+     * Узлы собираются в цепочку вне списка, которая затем присоединяется к head_ одной записью указателя,
+     * а размер и статистика обновляются один раз.
+     * Если при создании элемента будет выброшено исключение, список останется в прежнем состоянии
+     */
+    template <typename It, typename = EnableIfInputIterator<It>>
+    void PushFrontBatch(It first, It last);
 
-private:
+    // Вставляет элемент value в конец списка за время O(1)
+    // Доступно только при политике TailTracking
+    void PushBack(const Type& value);
 
-    template <typename It>
-    void MakeList(It start, It end);
-    
-    // Фиктивный узел, используется для вставки "перед первым элементом"
-    Node head_ = {};
-    size_t size_ = 0;
-};
+    // Вставляет элемент value в конец списка за время O(1), перемещая его
+    // Доступно только при политике TailTracking
+    void PushBack(Type&& value);
 
+    // Конструирует элемент в конце списка из аргументов args за время O(1)
+    // Возвращает ссылку на вставленный элемент
+    // Доступно только при политике TailTracking
+    template <typename... Args>
+    ElementReference EmplaceBack(Args&&... args);
 
+    // Возвращает ссылку на последний элемент непустого списка за время O(1)
+    // Доступно только при политике TailTracking
+    [[nodiscard]] ElementReference Back() noexcept;
+    [[nodiscard]] const Type& Back() const noexcept;
 
-template <typename Type>
-typename SingleLinkedList<Type>::Iterator SingleLinkedList<Type>::InsertAfter(ConstIterator pos, const Type& value) {
-	if(pos == cbefore_begin()){
-		PushFront(value);
-		++size_;
-		return begin();
-	} else {
-		Node* new_node = new Node(value, pos.node_->next_node);
-		pos.node_->next_node = new_node;
-		++size_;
-	return Iterator{new_node};
-	}
-        
-}
+    /*
+     * Переносит все узлы other в конец списка за время O(1), other становится пустым.
+     * Элементы не копируются. Аллокаторы списков должны быть равны
+     * Доступно только при политике TailTracking
+     */
+    void SpliceBack(SingleLinkedList& other) noexcept;
+    void SpliceBack(SingleLinkedList&& other) noexcept;
 
-template <typename Type>
-typename SingleLinkedList<Type>::Iterator SingleLinkedList<Type>::EraseAfter(ConstIterator pos) noexcept {
-    assert (pos.node_ != nullptr);
-	Node* to_delete_node = pos.node_->next_node;
-	pos.node_->next_node = to_delete_node->next_node;
-	delete to_delete_node;
-	--size_;
-        
-	return Iterator{pos.node_->next_node};
- }
+    // Переставляет элементы в обратном порядке за время O(N), меняя только указатели узлов.
+    // Итераторы остаются действительными и указывают на те же элементы
+    void Reverse() noexcept;
 
-template <typename Type>
-SingleLinkedList<Type>::SingleLinkedList(std::initializer_list<Type> values) {
-	MakeList(values.begin(), values.end());
-	size_ = values.size();
-}
+    /*
+     * Переставляет элементы интервала (first, last) так, что элемент, следующий за middle,
+     * становится первым в интервале: (x1 ... middle y1 ... yn) превращается в (y1 ... yn x1 ... middle).
+     * middle должен лежать в интервале. Выполняется за время O(K), где K - число элементов
+     * между middle и last (нужно найти последний из них). Элементы не копируются
+     */
+    void RotateAfter(ConstIterator first, ConstIterator middle, ConstIterator last) noexcept;
 
-template <typename Type>
-SingleLinkedList<Type>::SingleLinkedList(const SingleLinkedList<Type>& other) {
-	MakeList(other.begin(), other.end());
-	size_ = other.size_;
-}
+    // Делает первым элемент, следующий за middle, перенося элементы до middle включительно в конец списка.
+    // При политике TailTracking выполняется за время O(1), иначе - за время O(N)
+    void RotateAfter(ConstIterator middle) noexcept;
 
-template <typename Type>
-SingleLinkedList<Type>::~SingleLinkedList(){
-    Clear();
-}
+    /*
+     * Отрезает элементы, следующие за pos, и возвращает список, владеющий ими. Узлы не копируются,
+     * pos становится последним элементом. Помимо подсчёта K отрезанных элементов выполняется за время O(1);
+     * если pos - before_begin(), то всегда за время O(1). Новый список использует копию аллокатора
+     */
+    [[nodiscard]] SingleLinkedList SplitAfter(ConstIterator pos);
 
-template <typename Type>
-template <typename It>
-void SingleLinkedList<Type>::MakeList(It start, It end) {
-    std::stack<Type> tmp;
-    for(It it = start; it != end; ++it){
-        tmp.push(*it);
-    }
-    while(!tmp.empty()){
-        PushFront(tmp.top());
-        tmp.pop();
-    }
-}
+    /*
+     * Разрезает список на части по count элементов (последняя может быть короче) за один проход
+     * и возвращает их по порядку, например чтобы раздать потокам. Текущий список становится пустым.
+     * Выделяется память только под вектор частей; если это не удастся, список не изменится
+     */
+    [[nodiscard]] std::vector<SingleLinkedList> SplitEvery(size_t count);
 
-template <typename Type>
-void SingleLinkedList<Type>::PushFront(const Type& value) {
-	head_.next_node = new Node(value, head_.next_node);
-	++size_;
-}
+    /*
+     * Сортирует список устойчивой восходящей сортировкой слиянием за время O(N log N).
+     * Узлы переставляются без копирования элементов и без выделения памяти.
+     * Если comp выбросит исключение, список сохранит все элементы в неопределённом порядке
+     */
+    template <typename Compare = std::less<>>
+    void Sort(Compare comp = Compare{});
 
-template <typename Type>
-void SingleLinkedList<Type>::Clear() noexcept {
-	while(head_.next_node){
-		Node* tmp = head_.next_node->next_node;
-		delete head_.next_node;
-		head_.next_node = tmp;
-	}
-    size_ = 0;
-}
+    /*
+     * Сливает отсортированный список other с текущим отсортированным списком за время O(N + M).
+     * Узлы other переносятся без копирования, other становится пустым.
+     * Среди равных элементов элементы текущего списка идут первыми. Аллокаторы списков должны быть равны
+     */
+    template <typename Compare = std::less<>>
+    void Merge(SingleLinkedList& other, Compare comp = Compare{});
 
-template <typename Type>
-void SingleLinkedList<Type>::swap(SingleLinkedList<Type>& other) noexcept {
-	Node* next_node = head_.next_node;
-	size_t t_size = size_;
-        
-	size_ = other.size_;
-	head_.next_node = other.head_.next_node;
-        
-	other.size_ = t_size;
-	other.head_.next_node = next_node;
-}
+    template <typename Compare = std::less<>>
+    void Merge(SingleLinkedList&& other, Compare comp = Compare{});
 
-template <typename Type>
-void SingleLinkedList<Type>::PopFront() noexcept {
-    assert(size_ > 0);
-	Node* tmp = head_.next_node->next_node;
-	delete head_.next_node;
-	head_.next_node = tmp;
-	--size_;
-}
+    /*
+     * Удаляет из каждой группы подряд идущих элементов, для которых pred(первый, текущий) истинно,
+     * все элементы, кроме первого. Удалённые узлы освобождаются одной пачкой в конце.
+     * Возвращает количество удалённых элементов
+     */
+    template <typename BinaryPredicate = std::equal_to<>>
+    size_t Unique(BinaryPredicate pred = BinaryPredicate{});
 
-template <typename Type>
-SingleLinkedList<Type>& SingleLinkedList<Type>::operator=(const SingleLinkedList<Type>& rhs) {
-    if(this != &rhs){
-        auto rhs_copy(rhs);
-        swap(rhs_copy);
-    }
-    return *this;
-}
+    /*
+     * Удаляет элементы, для которых pred возвращает true. Удалённые узлы освобождаются
+     * одной пачкой в конце, поэтому pred может ссылаться на элементы этого же списка.
+     * Возвращает количество удалённых элементов
+     */
+    template <typename UnaryPredicate>
+    size_t RemoveIf(UnaryPredicate pred);
 
-template <typename Type>
-bool SingleLinkedList<Type>::IsEmpty() const noexcept {
-    return size_ == 0;
-}
+    // Удаляет элементы, равные value. Возвращает количество удалённых элементов
+    size_t Remove(const Type& value);
 
-template <typename Type>
-size_t SingleLinkedList<Type>::GetSize() const noexcept {
-    return size_;
-}
+    /*
+     * Вызывает f для каждого элемента списка по порядку и возвращает f.
+     * Пока f обрабатывает элемент, следующий узел уже запрашивается из памяти
+     * программной предвыборкой, поэтому время обработки перекрывает задержку загрузки узла
+     */
+    template <typename Function>
+    Function ForEach(Function f);
 
+    template <typename Function>
+    Function ForEach(Function f) const;
 
-template <typename Type>
-void swap(SingleLinkedList<Type>& lhs, SingleLinkedList<Type>& rhs) noexcept {
-    lhs.swap(rhs);
-}
+    /*
+     * Обходит список порциями по ChunkSize элементов: сначала собирает адреса элементов порции,
+     * затем одним вызовом f(items, count) передаёт их обработчику. Загрузки внутри f
+     * не зависят друг от друга и от обхода цепочки. Последняя порция может быть неполной
+     */
+    template <size_t ChunkSize = 16, typename Function>
+    Function ForEachChunked(Function f);
 
-template <typename Type>
-bool operator==(const SingleLinkedList<Type>& lhs, const SingleLinkedList<Type>& rhs) {
-    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
-}
+    template <size_t ChunkSize = 16, typename Function>
+    Function ForEachChunked(Function f) const;
 
-template <typename Type>
-bool operator!=(const SingleLinkedList<Type>& lhs, const SingleLinkedList<Type>& rhs) {
-    return !(lhs == rhs);
-}
+    // Сворачивает элементы списка слева направо: init = op(init, element)
+    template <typename Value, typename BinaryOperation = std::plus<>>
+    [[nodiscard]] Value Accumulate(Value init, BinaryOperation op = BinaryOperation{}) const;
 
-template <typename Type>
-bool operator<(const SingleLinkedList<Type>& lhs, const SingleLinkedList<Type>& rhs) {
-    return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
-}
+    /*
+     * Параллельные алгоритмы. Список за один проход делится на участки примерно равной длины,
+     * каждый участок обрабатывается в своём потоке, первый - в вызывающем.
+     * thread_count ограничивает число потоков; 0 означает std::thread::hardware_concurrency().
+     * Участок содержит не менее PARALLEL_MIN_SEGMENT_SIZE элементов, поэтому короткие списки
+     * обрабатываются последовательно. Если какой-либо поток выбросит исключение, алгоритм дождётся
+     * остальных потоков и выбросит первое по порядку участков исключение.
+     * Если поток не удаётся запустить, его участок обрабатывается в вызывающем потоке
+     */
+    static constexpr size_t PARALLEL_MIN_SEGMENT_SIZE = 1024;
 
-template <typename Type>
-bool operator>(const SingleLinkedList<Type>& lhs, const SingleLinkedList<Type>& rhs) {
-    return rhs < lhs;
-}
+    // Вызывает f для каждого элемента. f вызывается одновременно из нескольких потоков
+    // в неопределённом порядке, поэтому должна быть безопасна для такого вызова
+    template <typename Function>
+    void ParallelForEach(Function f, size_t thread_count = 0);
 
-template <typename Type>
-bool operator<=(const SingleLinkedList<Type>& lhs, const SingleLinkedList<Type>& rhs) {
-    return (lhs < rhs) || (lhs == rhs);
-}
+    template <typename Function>
+    void ParallelForEach(Function f, size_t thread_count = 0) const;
+
+    /*
+     * Сворачивает элементы, как Accumulate, но участки сворачиваются параллельно, начиная
+     * с первого элемента участка, приведённого к Value, а затем результаты объединяются по порядку.
+     * Результат совпадает с Accumulate, если op ассоциативна и принимает аргументы (Value, Value)
+     */
+    template <typename Value, typename BinaryOperation = std::plus<>>
+    [[nodiscard]] Value ParallelReduce(Value init, BinaryOperation op = BinaryOperation{}, size_t thread_count = 0) const;
+
+    /*
+     * Устойчиво сортирует список: участки сортируются параллельно, затем попарно сливаются,
+     * слияния одного уровня также выполняются параллельно. Узлы только переставляются,
+     * каждый поток использует свою копию comp.
+     * Если comp выбросит исключение, список сохранит все элементы в неопределённом порядке
+     */
+    template <typename Compare = std::less<>>
+    void ParallelSort(Compare comp = Compare{}, size_t thread_count = 0);
+
+    /*
+     * Двоичная сериализация списка тривиально копируемых элементов.
+     * Формат: количество элементов (std::uint64_t), затем байты элементов подряд без выравнивания.
+     * Представление зависит от платформы: читать данные должна программа с тем же
+     * порядком байт и тем же представлением Type
+     */
+    // Количество байт, которое запишет Serialize
+    [[nodiscard]] size_t GetSerializedSize() const noexcept;
+
+    // Записывает список в поток. Ошибки записи отражаются в состоянии потока
+    void Serialize(std::ostream& out) const;
+
+    // Записывает список в буфер и возвращает количество записанных байт.
+    // Если буфер меньше GetSerializedSize(), выбрасывает std::length_error
+    size_t Serialize(void* buffer, size_t buffer_size) const;
+
+    /*
+     * Читает список, записанный Serialize, за один проход: узлы создаются аллокатором alloc
+     * и собираются в цепочку по мере чтения, без промежуточного контейнера.
+     * Если данные закончились раньше, выбрасывает std::runtime_error
+     */
+    [[nodiscard]] static SingleLinkedList Deserialize(std::istream& in, const Allocator& alloc = Allocator());
+
+    // Читает список из буфера. Байты после сериализованного списка игнорируются
+    [[nodiscard]] static SingleLinkedList Deserialize(const void* data, size_t size,
+                                                      const Allocator& alloc = Allocator());
+
+    /*
+     * Очищает список за время O(N).
+     * Если узлы тривиально разрушаемы, а аллокатор владеет только узлами этого списка
+     * и умеет освобождать память целиком (ArenaAllocator), узлы не обходятся
+     * и память возвращается за время O(числа кусков арены)
+     */
+    void Clear() noexcept;
+
+    // То же, что Clear, но при освобождении арены целиком память освобождает фоновый поток.
+    // В остальных случаях выполняет обычный Clear
+    void ClearAsync() noexcept;
+
+    // Возвращает количество элементов в списке за время O(1)
+    [[nodiscard]] size_t GetSize() const noexcept;
+
+    // Сообщает, пустой ли список за время O(1)
+    [[nodiscard]] bool IsEmpty() const noexcept;
+
+    /*
+     * Готовит список к хранению capacity элементов без обращения к аллокатору: недостающие узлы
+     * выделяются заранее и кладутся в запас. Пока запас не превышает capacity узлов, удаление
+     * элементов (EraseAfter, PopFront, Clear и другие) возвращает узлы в запас, а не аллокатору.
+     * Запас принадлежит объекту списка: он не копируется и не переносится при перемещении, но обменивается в swap.
+     * Если аллокатор выбросит исключение, уже выделенные узлы останутся в запасе
+     * Доступно только при политике NodeReserve
+     */
+    void Reserve(size_t capacity);
+
+    // Возвращает аллокатору все узлы запаса и отменяет действие Reserve
+    // Доступно только при политике NodeReserve
+    void ShrinkToFit() noexcept;
+
+    // Возвращает количество элементов, которое список может хранить без обращения к аллокатору:
+    // размер списка плюс число узлов в запасе
+    // Доступно только при политике NodeReserve
+    [[nodiscard]] size_t GetCapacity() const noexcept;
+
+    /*
+     * Лексикографически сравнивает список с other за один проход.
+     * Возвращает отрицательное число, если список меньше other, ноль, если списки равны,
+     * и положительное число, если список больше. Элементы сравниваются только оператором <
+     */
+    [[nodiscard]] int CompareTo(const SingleLinkedList& other) const;
+
+    /*
+     * Возвращает хеш содержимого списка, зависящий от порядка элементов. Равные списки имеют
+     * равные хеши независимо от политик. Без политики IncrementalFingerprint хеш вычисляется
+     * за время O(N). С ней - за время O(1), если отпечаток актуален; устаревший отпечаток
+     * пересчитывается за время O(N) и запоминается.
+     * Как и статистика, отпечаток изменяется константными методами, поэтому одновременный вызов
+     * GetHash для одного списка из нескольких потоков требует внешней синхронизации
+     */
+    [[nodiscard]] size_t GetHash() const;
+
+    /*
+     * Сравнивает списки на равенство. Списки разной длины не равны без обхода.
+     * При политике IncrementalFingerprint списки с разными актуальными отпечатками
+     * также не равны без обхода
+     */
+    [[nodiscard]] bool IsEqualTo(const SingleLinkedList& other) const;
+
+    /*
+     * Возвращает ссылку на элемент с номером index за время O(sqrt(N)).
+     * Выбрасывает std::out_of_range, если index >= GetSize().
+     * Как и GetHash, устаревший индекс перестраивается константными методами, поэтому
+     * одновременный поиск в одном списке из нескольких потоков требует внешней синхронизации
+     * Доступно только при политике SkipIndex
+     */
+    [[nodiscard]] ElementReference At(size_t index);
+    [[nodiscard]] const Type& At(size_t index) const;
+
+    /*
+     * Возвращает итератор, отстоящий от pos на count позиций вперёд, как после count инкрементов.
+     * Итератор можно продвинуть не дальше end(). pos может быть before_begin().
+     * Короткие переходы выполняются обходом, длинные - за время O(sqrt(N)) по индексу
+     * Доступно только при политике SkipIndex
+     */
+    [[nodiscard]] Iterator Advance(ConstIterator pos, size_t count);
+    [[nodiscard]] ConstIterator Advance(ConstIterator pos, size_t count) const;
+
+    /*
+     * В списке, отсортированном по comp, возвращает итератор на первый элемент, для которого
+     * comp(элемент, value) ложно, либо end(). Участок находится двоичным поиском по первым элементам
+     * участков, поэтому поиск выполняется за время O(sqrt(N))
+     * Доступно только при политике SkipIndex
+     */
+    template <typename Compare = std::less<>>
+    [[nodiscard]] Iterator LowerBound(const Type& value, Compare comp = Compare{});
+
+    template <typename Compare = std::less<>>
+    [[nodiscard]] ConstIterator LowerBound(const Type& value, Compare comp = Compare{}) const;
+
+    /*
+     * То же, что LowerBound, но возвращает итератор на позицию перед найденным элементом
+     * (before_begin(), если все элементы не меньше value). Результат можно передать в InsertAfter,
+     * чтобы вставить value, сохранив порядок
+     * Доступно только при политике SkipIndex
+     */
+    template <typename Compare = std::less<>>
+    [[nodiscard]] Iterator LowerBoundBefore(const Type& value, Compare comp = Compare{});
+
+    template <typename Compare = std::less<>>
+    [[nodiscard]] ConstIterator LowerBoundBefore(const Type& value, Compare comp = Compare{}) const;
+
+    // Возвращает копию аллокатора, которым выделяются узлы списка
+    [[nodiscard]] allocator_type get_allocator() const noexcept;
+
+    // Возвращает снимок статистики списка
+    // Доступно только при политике CollectListStatistics
+    [[nodiscard]] ListStatisticsSnapshot GetStatistics() const noexcept;
+
+    // Задаёт метку, под которой статистика списка выводится реестром.
+    // Строка label должна существовать, пока существует список
+    // Доступно только при политике CollectListStatistics
+    void SetStatisticsLabel(const char* label) noexcept;
+
+    // Возвращает диапазон элементов списка, инкременты итераторов которого учитываются в статистике:
+    //     for (int value : list.Counted()) { ... }
+    //     auto evens = list.Counted() | std::views::filter(is_even) | ToList<SingleLinkedList>();
+    // Обходы обычными итераторами в статистике не учитываются
+    // Доступно только при политике CollectListStatistics
+    [[nodiscard]] CountedView Counted() noexcept;
+    [[nodiscard]] ConstCountedView Counted() const noexcept;
+
+private:
+
+    SingleLinkedList(const SingleLinkedList& other, const NodeAllocator& alloc);
+
+    // Создаёт узел при помощи аллокатора узлов, конструируя значение из аргументов args
+    // Если при создании узла будет выброшено исключение, выделенная память освобождается
+    template <typename... Args>
+    Node* CreateNode(Node* next, Args&&... args);
+
+    // Забирает узлы other, оставляя его пустым
+    void StealNodes(SingleLinkedList& other) noexcept;
+
+    // Разрушает узел и возвращает его память в запас либо аллокатору
+    void DestroyNode(Node* node) noexcept;
+
+    // Берёт память узла из запаса, а если он пуст - у аллокатора
+    Node* AllocateNode();
+
+    // Возвращает память узла в запас, если в нём есть место, иначе - аллокатору
+    void DeallocateNode(Node* node) noexcept;
+
+    // Возвращает аллокатору все узлы запаса. При NoNodeReserve ничего не делает
+    void ReleaseSpareNodes() noexcept;
+
+    // Возвращает узел, на который указывает node, либо nullptr, если node - фиктивный узел head_
+    Node* ToNode(NodeBase* node) noexcept;
+
+    /*
+     * Создаёт цепочку узлов из элементов диапазона [first, last) за один проход,
+     * добавляя узлы в её конец. last может быть стражем другого типа.
+     * Если при создании элемента будет выброшено исключение, созданные узлы удаляются
+     */
+    template <typename It, typename Sentinel>
+    Chain MakeChain(It first, Sentinel last);
+
+    // Создаёт цепочку из count копий value
+    Chain MakeChain(size_t count, const Type& value);
+
+    // Добавляет в конец цепочки узел, сконструированный из аргументов args
+    template <typename... Args>
+    void AppendToChain(Chain& chain, Args&&... args);
+
+    // Присоединяет существующий узел к концу цепочки
+    static void AttachToChain(Chain& chain, Node* node) noexcept;
+
+    /*
+     * Сливает отсортированную цепочку other с отсортированной цепочкой dest и сохраняет результат в dest.
+     * Если comp выбросит исключение, dest будет содержать все узлы обеих цепочек
+     */
+    template <typename Compare>
+    static void MergeChains(Node*& dest, Node* other, Compare& comp);
+
+    // Заново находит последний узел списка
+    void UpdateTail() noexcept;
+
+    // Восстанавливает значение тривиально копируемого Type из его байтового представления
+    static Type LoadValue(const unsigned char* bytes) noexcept;
+
+    // Запрашивает загрузку узла в кеш, не дожидаясь её завершения
+    static void Prefetch(const NodeBase* node) noexcept;
+
+    template <typename Self, typename Function>
+    static void ForEachNode(Self& self, Function& f);
+
+    template <size_t ChunkSize, typename Self, typename Function>
+    static void ForEachNodeChunked(Self& self, Function& f);
+
+    // Количество участков для параллельного алгоритма, не меньше 1
+    [[nodiscard]] size_t GetParallelSegmentCount(size_t thread_count) const noexcept;
+
+    // Длина участка index из count. Первые size_ % count участков длиннее остальных на один элемент
+    [[nodiscard]] size_t GetSegmentSize(size_t index, size_t count) const noexcept;
+
+    // Возвращает count + 1 указателей: первые узлы count участков и nullptr в конце
+    [[nodiscard]] std::vector<Node*> GetSegmentBounds(size_t count) const;
+
+    // Вызывает task(i) для i из [0, count): task(0) в вызывающем потоке, остальные в новых потоках
+    template <typename Task>
+    static void RunInParallel(size_t count, Task& task);
+
+    template <typename Self, typename Function>
+    static void ParallelForEachNode(Self& self, Function& f, size_t thread_count);
+
+    // Сортирует цепочку, начинающуюся после head. Если comp выбросит исключение,
+    // цепочка сохранит все узлы в неопределённом порядке
+    template <typename Compare>
+    static void SortChain(NodeBase& head, Compare& comp);
+
+    // Присоединяет цепочку к списку после pos и возвращает итератор на её последний элемент
+    Iterator LinkChainAfter(NodeBase* pos, Chain chain) noexcept;
+
+    // Переносит узлы от узла, следующего за middle, до last_moved включительно на место перед узлом,
+    // следующим за before. middle должен стоять после before
+    void RotateLinks(NodeBase* before, NodeBase* middle, Node* last_moved) noexcept;
+
+    // Освобождает все узлы списка вместе с памятью аллокатора, если это возможно без обхода узлов.
+    // Возвращает false, если узлы нужно удалять по одному
+    bool TryReleaseAll(bool async) noexcept;
+
+    // Удаляет узлы, начиная с first и до last (не включая его). Возвращает количество удалённых узлов
+    size_t DestroyChain(Node* first, Node* last = nullptr) noexcept;
+
+    /*
+     * Переносит узлы списка other, начиная с узла, следующего за before_first, и заканчивая
+     * last_moved включительно, в текущий список после pos. count - число переносимых узлов
+     */
+    void TransferAfter(NodeBase* pos, SingleLinkedList& other, NodeBase* before_first, Node* last_moved,
+                       size_t count) noexcept;
+
+    // Заполняет пустой список элементами диапазона [first, last)
+    template <typename It, typename Sentinel>
+    void MakeList(It first, Sentinel last);
+
+    // Создают итераторы на node
+    Iterator MakeIterator(NodeBase* node) noexcept;
+    ConstIterator MakeConstIterator(const NodeBase* node) const noexcept;
+
+    // Сообщает статистике новый размер списка. При NoListStatistics ничего не делает
+    void UpdateSizeStatistics() noexcept;
+
+    // Учитывает в статистике steps переходов между узлами. При NoListStatistics ничего не делает
+    void CountTraversal(size_t steps) const noexcept;
+
+    // Перемешивает биты std::hash<Type>: для целых чисел он часто возвращает само значение
+    static std::uint64_t HashElement(const Type& value) noexcept;
+
+    // Обновляют отпечаток после вставки value в начало и в конец списка
+    // и перед удалением первого элемента value. При NoFingerprint ничего не делают
+    void FingerprintPushFront(const Type& value) noexcept;
+    void FingerprintPushBack(const Type& value) noexcept;
+    void FingerprintPopFront(const Type& value) noexcept;
+
+    // Помечает отпечаток устаревшим после изменения, которое нельзя учесть за время O(1)
+    void InvalidateFingerprint() noexcept;
+
+    // Сбрасывает отпечаток в состояние пустого списка
+    void ResetFingerprint() noexcept;
+
+    // Возвращает хеш элементов в виде отпечатка, пересчитывая его при необходимости
+    std::uint64_t GetFingerprintHash() const;
+
+    // Учитывает в индексе узел node, только что вставленный после pos
+    // При NoSkipIndex ничего не делает. Если памяти для участка не хватит, индекс помечается устаревшим
+    void SkipIndexInsert(NodeBase* pos, Node* node) noexcept;
+
+    // Убирает из индекса узел node перед его удалением из списка. При NoSkipIndex ничего не делает
+    void SkipIndexErase(Node* node) noexcept;
+
+    // Делит участок пополам за время O(длины участка)
+    void SplitSegment(IndexSegment& segment);
+
+    // Обновляет номера участков индекса, начиная с from
+    void RenumberSegments(size_t from) noexcept;
+
+    // Помечает индекс устаревшим после изменения, которое нельзя учесть за время O(1)
+    void InvalidateSkipIndex() noexcept;
+
+    // Сбрасывает индекс в состояние пустого списка
+    void ResetSkipIndex() noexcept;
+
+    // Желаемая длина участка для списка из size элементов
+    static size_t GetIndexSegmentSize(size_t size) noexcept;
+
+    // Сообщает, что индекс актуален, а его участки не слишком длинные и не слишком многочисленные для size_ элементов
+    [[nodiscard]] bool IsSkipIndexBalanced() const noexcept;
+
+    // Перестраивает индекс, если он устарел или разбалансирован
+    void UpdateSkipIndex() const;
+
+    // Возвращает номер элемента node. Индекс должен быть актуален
+    size_t GetIndexOf(const Node* node) const noexcept;
+
+    // Возвращает узел с номером index < size_. Индекс должен быть актуален
+    Node* FindNode(size_t index) const noexcept;
+
+    // Возвращает последний узел, для которого comp(значение, value) истинно, либо nullptr,
+    // если такого нет. Индекс должен быть актуален
+    template <typename Compare>
+    Node* FindLastLess(const Type& value, Compare& comp) const;
+
+    // Фиктивный узел, используется для вставки "перед первым элементом"
+    NodeBase head_ = {};
+    size_t size_ = 0;
+    // Последний узел списка либо nullptr, если список пуст
+    [[no_unique_address]] TailPointer tail_ = {};
+    [[no_unique_address]] NodeAllocator node_alloc_;
+    // Статистику изменяют и константные методы: обходы ForEach, Accumulate, поиск и итераторы Counted() считают переходы
+    [[no_unique_address]] mutable Statistics statistics_;
+    [[no_unique_address]] Spares spares_ = {};
+    // Отпечаток пересчитывается и константными методами (см. GetHash)
+    [[no_unique_address]] mutable FingerprintState fingerprint_ = {};
+    // Индекс перестраивается и константными методами (см. At)
+    [[no_unique_address]] mutable SkipIndexState skip_index_ = {};
+};
+
+
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+typename SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::Iterator SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::InsertAfter(ConstIterator pos, const Type& value) {
+    return EmplaceAfter(pos, value);
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+typename SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::Iterator SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::InsertAfter(ConstIterator pos, Type&& value) {
+    return EmplaceAfter(pos, std::move(value));
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+template <typename... Args>
+typename SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::Iterator SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::EmplaceAfter(ConstIterator pos, Args&&... args) {
+    assert (pos.node_ != nullptr);
+    Node* new_node = CreateNode(pos.node_->next_node, std::forward<Args>(args)...);
+    pos.node_->next_node = new_node;
+    ++size_;
+    UpdateSizeStatistics();
+    if (pos.node_ == &head_) {
+        FingerprintPushFront(new_node->value);
+    } else {
+        InvalidateFingerprint();
+    }
+    SkipIndexInsert(pos.node_, new_node);
+    if constexpr (TRACKS_TAIL) {
+        if (new_node->next_node == nullptr) {
+            tail_ = new_node;
+        }
+    }
+    return MakeIterator(new_node);
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+typename SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::Iterator SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::InsertAfter(ConstIterator pos, size_t count, const Type& value) {
+    assert (pos.node_ != nullptr);
+    if (count == 0) {
+        return MakeIterator(pos.node_);
+    }
+    return LinkChainAfter(pos.node_, MakeChain(count, value));
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+template <typename It, typename>
+typename SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::Iterator SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::InsertAfter(ConstIterator pos, It first, It last) {
+    assert (pos.node_ != nullptr);
+    if (first == last) {
+        return MakeIterator(pos.node_);
+    }
+    return LinkChainAfter(pos.node_, MakeChain(first, last));
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+typename SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::Iterator SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::InsertAfter(ConstIterator pos, std::initializer_list<Type> values) {
+    return InsertAfter(pos, values.begin(), values.end());
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+typename SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::Iterator SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::EraseAfter(ConstIterator pos) noexcept {
+    assert (pos.node_ != nullptr);
+	Node* to_delete_node = pos.node_->next_node;
+    if (pos.node_ == &head_) {
+        FingerprintPopFront(to_delete_node->value);
+    } else {
+        InvalidateFingerprint();
+    }
+    SkipIndexErase(to_delete_node);
+	pos.node_->next_node = to_delete_node->next_node;
+    if constexpr (TRACKS_TAIL) {
+        if (to_delete_node == tail_) {
+            tail_ = ToNode(pos.node_);
+        }
+    }
+	DestroyNode(to_delete_node);
+	--size_;
+    UpdateSizeStatistics();
+        
+	return MakeIterator(pos.node_->next_node);
+ }
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+typename SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::Iterator SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::EraseAfter(ConstIterator first, ConstIterator last) noexcept {
+    assert (first.node_ != nullptr);
+    Node* to_delete = first.node_->next_node;
+    Node* stop = static_cast<Node*>(last.node_);
+    if (to_delete == stop) {
+        return MakeIterator(last.node_);
+    }
+    first.node_->next_node = stop;
+    if constexpr (TRACKS_TAIL) {
+        if (stop == nullptr) {
+            tail_ = ToNode(first.node_);
+        }
+    }
+    size_ -= DestroyChain(to_delete, stop);
+    InvalidateFingerprint();
+    InvalidateSkipIndex();
+    UpdateSizeStatistics();
+    return MakeIterator(last.node_);
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::SpliceAfter(ConstIterator pos, SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>& other) noexcept {
+    assert (pos.node_ != nullptr);
+    assert (this != &other);
+    if (other.IsEmpty()) {
+        return;
+    }
+    Node* last_moved = nullptr;
+    if constexpr (TRACKS_TAIL) {
+        last_moved = other.tail_;
+    } else {
+        last_moved = other.head_.next_node;
+        while (last_moved->next_node != nullptr) {
+            last_moved = last_moved->next_node;
+        }
+    }
+    TransferAfter(pos.node_, other, &other.head_, last_moved, other.size_);
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::SpliceAfter(ConstIterator pos, SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>&& other) noexcept {
+    SpliceAfter(pos, other);
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::SpliceAfter(ConstIterator pos, SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>& other, ConstIterator it) noexcept {
+    assert (pos.node_ != nullptr && it.node_ != nullptr);
+    Node* moved = it.node_->next_node;
+    if (moved == nullptr || pos.node_ == it.node_ || pos.node_ == moved) {
+        return;
+    }
+    TransferAfter(pos.node_, other, it.node_, moved, 1);
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::SpliceAfter(ConstIterator pos, SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>&& other, ConstIterator it) noexcept {
+    SpliceAfter(pos, other, it);
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::SpliceAfter(ConstIterator pos, SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>& other, ConstIterator first, ConstIterator last) noexcept {
+    assert (pos.node_ != nullptr && first.node_ != nullptr);
+    if (first.node_->next_node == last.node_ || pos.node_ == first.node_) {
+        return;
+    }
+    Node* last_moved = first.node_->next_node;
+    size_t count = 1;
+    while (last_moved->next_node != last.node_) {
+        last_moved = last_moved->next_node;
+        ++count;
+    }
+    TransferAfter(pos.node_, other, first.node_, last_moved, count);
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::SpliceAfter(ConstIterator pos, SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>&& other, ConstIterator first, ConstIterator last) noexcept {
+    SpliceAfter(pos, other, first, last);
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::TransferAfter(NodeBase* pos, SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>& other, NodeBase* before_first, Node* last_moved,
+                                                             size_t count) noexcept {
+    assert(node_alloc_ == other.node_alloc_);
+    Node* first_moved = before_first->next_node;
+    // Отсоединяем узлы от other
+    before_first->next_node = last_moved->next_node;
+    if constexpr (TRACKS_TAIL) {
+        if (other.tail_ == last_moved) {
+            other.tail_ = other.ToNode(before_first);
+        }
+    }
+    other.size_ -= count;
+    other.UpdateSizeStatistics();
+    other.InvalidateFingerprint();
+    other.InvalidateSkipIndex();
+
+    // Присоединяем узлы к текущему списку
+    last_moved->next_node = pos->next_node;
+    pos->next_node = first_moved;
+    if constexpr (TRACKS_TAIL) {
+        if (last_moved->next_node == nullptr) {
+            tail_ = last_moved;
+        }
+    }
+    size_ += count;
+    UpdateSizeStatistics();
+    InvalidateFingerprint();
+    InvalidateSkipIndex();
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::SingleLinkedList(const Allocator& alloc) noexcept
+    : node_alloc_(alloc) {
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::SingleLinkedList(std::initializer_list<Type> values, const Allocator& alloc)
+    : node_alloc_(alloc) {
+	MakeList(values.begin(), values.end());
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+template <typename It, typename>
+SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::SingleLinkedList(It first, It last, const Allocator& alloc)
+    : node_alloc_(alloc) {
+    MakeList(first, last);
+}
+
+#if __cplusplus > 201703L
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+template <std::ranges::input_range Range>
+    requires std::constructible_from<Type, std::ranges::range_reference_t<Range>>
+SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy> SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::FromRange(Range&& range, const Allocator& alloc) {
+    SingleLinkedList list(alloc);
+    list.MakeList(std::ranges::begin(range), std::ranges::end(range));
+    return list;
+}
+#endif
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::SingleLinkedList(const SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>& other)
+    : SingleLinkedList(other, NodeAllocTraits::select_on_container_copy_construction(other.node_alloc_)) {
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::SingleLinkedList(const SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>& other, const NodeAllocator& alloc)
+    : node_alloc_(alloc) {
+	MakeList(other.begin(), other.end());
+    fingerprint_ = other.fingerprint_;
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::SingleLinkedList(SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>&& other) noexcept
+    : node_alloc_(std::move(other.node_alloc_)) {
+    StealNodes(other);
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::~SingleLinkedList(){
+    Clear();
+    ReleaseSpareNodes();
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+template <typename It, typename Sentinel>
+typename SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::Chain SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::MakeChain(It first, Sentinel last) {
+    Chain chain;
+    try {
+        for (; first != last; ++first) {
+            AppendToChain(chain, *first);
+        }
+    } catch (...) {
+        DestroyChain(chain.first);
+        throw;
+    }
+    return chain;
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+typename SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::Chain SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::MakeChain(size_t count, const Type& value) {
+    Chain chain;
+    try {
+        for (; count > 0; --count) {
+            AppendToChain(chain, value);
+        }
+    } catch (...) {
+        DestroyChain(chain.first);
+        throw;
+    }
+    return chain;
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+template <typename... Args>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::AppendToChain(Chain& chain, Args&&... args) {
+    AttachToChain(chain, CreateNode(nullptr, std::forward<Args>(args)...));
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::AttachToChain(Chain& chain, Node* node) noexcept {
+    node->next_node = nullptr;
+    if (chain.last) {
+        chain.last->next_node = node;
+    } else {
+        chain.first = node;
+    }
+    chain.last = node;
+    ++chain.size;
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+template <typename Compare>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::MergeChains(Node*& dest, Node* other, Compare& comp) {
+    Node* first = dest;
+    NodeBase merged;
+    NodeBase* tail = &merged;
+    try {
+        while (first != nullptr && other != nullptr) {
+            if (comp(other->value, first->value)) {
+                tail->next_node = other;
+                other = other->next_node;
+            } else {
+                tail->next_node = first;
+                first = first->next_node;
+            }
+            tail = tail->next_node;
+        }
+    } catch (...) {
+        // Сохраняем оставшиеся узлы обеих цепочек, чтобы ни один узел не потерялся
+        tail->next_node = first;
+        while (tail->next_node != nullptr) {
+            tail = tail->next_node;
+        }
+        tail->next_node = other;
+        dest = merged.next_node;
+        throw;
+    }
+    tail->next_node = first != nullptr ? first : other;
+    dest = merged.next_node;
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::UpdateTail() noexcept {
+    if constexpr (TRACKS_TAIL) {
+        NodeBase* last = &head_;
+        while (last->next_node != nullptr) {
+            last = last->next_node;
+        }
+        tail_ = ToNode(last);
+    }
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+typename SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::Iterator SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::LinkChainAfter(NodeBase* pos, Chain chain) noexcept {
+    assert(chain.first != nullptr);
+    chain.last->next_node = pos->next_node;
+    pos->next_node = chain.first;
+    size_ += chain.size;
+    UpdateSizeStatistics();
+    InvalidateFingerprint();
+    InvalidateSkipIndex();
+    if constexpr (TRACKS_TAIL) {
+        if (chain.last->next_node == nullptr) {
+            tail_ = chain.last;
+        }
+    }
+    return MakeIterator(chain.last);
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+typename SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::Node* SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::ToNode(NodeBase* node) noexcept {
+    return node == &head_ ? nullptr : static_cast<Node*>(node);
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+typename SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::Iterator SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::MakeIterator(NodeBase* node) noexcept {
+    return Iterator{node};
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+typename SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::ConstIterator SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::MakeConstIterator(const NodeBase* node) const noexcept {
+    return ConstIterator{const_cast<NodeBase*>(node)};
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::UpdateSizeStatistics() noexcept {
+    if constexpr (COLLECTS_STATISTICS) {
+        statistics_.OnResize(size_, sizeof(Node));
+    }
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::CountTraversal(size_t steps) const noexcept {
+    if constexpr (COLLECTS_STATISTICS) {
+        statistics_.OnTraverse(steps);
+    } else {
+        (void)steps;
+    }
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+std::uint64_t SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::HashElement(const Type& value) noexcept {
+    // Финализатор splitmix64
+    std::uint64_t x = static_cast<std::uint64_t>(std::hash<Type>{}(value)) + 0x9E3779B97F4A7C15ull;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+    return x ^ (x >> 31);
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::FingerprintPushFront(const Type& value) noexcept {
+    if constexpr (MAINTAINS_FINGERPRINT) {
+        if (fingerprint_.is_valid) {
+            fingerprint_.hash += HashElement(value) * fingerprint_.power;
+            fingerprint_.power *= FINGERPRINT_BASE;
+        }
+    } else {
+        (void)value;
+    }
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::FingerprintPushBack(const Type& value) noexcept {
+    if constexpr (MAINTAINS_FINGERPRINT) {
+        if (fingerprint_.is_valid) {
+            fingerprint_.hash = fingerprint_.hash * FINGERPRINT_BASE + HashElement(value);
+            fingerprint_.power *= FINGERPRINT_BASE;
+        }
+    } else {
+        (void)value;
+    }
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::FingerprintPopFront(const Type& value) noexcept {
+    if constexpr (MAINTAINS_FINGERPRINT) {
+        if (fingerprint_.is_valid) {
+            fingerprint_.power *= FINGERPRINT_BASE_INVERSE;
+            fingerprint_.hash -= HashElement(value) * fingerprint_.power;
+        }
+    } else {
+        (void)value;
+    }
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::InvalidateFingerprint() noexcept {
+    if constexpr (MAINTAINS_FINGERPRINT) {
+        fingerprint_.is_valid = false;
+    }
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::ResetFingerprint() noexcept {
+    if constexpr (MAINTAINS_FINGERPRINT) {
+        fingerprint_ = {};
+    }
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+std::uint64_t SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::GetFingerprintHash() const {
+    if constexpr (MAINTAINS_FINGERPRINT) {
+        if (fingerprint_.is_valid) {
+            return fingerprint_.hash;
+        }
+    }
+    std::uint64_t hash = 0;
+    std::uint64_t power = 1;
+    for (const NodeBase* node = head_.next_node; node != nullptr; node = node->next_node) {
+        hash = hash * FINGERPRINT_BASE + HashElement(static_cast<const Node*>(node)->value);
+        power *= FINGERPRINT_BASE;
+    }
+    if constexpr (MAINTAINS_FINGERPRINT) {
+        fingerprint_ = {hash, power, true};
+    }
+    return hash;
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::SkipIndexInsert(NodeBase* pos, Node* node) noexcept {
+    if constexpr (MAINTAINS_SKIP_INDEX) {
+        if (!skip_index_.is_valid) {
+            return;
+        }
+        try {
+            IndexSegment* segment = nullptr;
+            if (pos != &head_) {
+                segment = static_cast<Node*>(pos)->segment;
+            } else if (!skip_index_.segments.empty()) {
+                // Новый первый узел входит в первый участок
+                segment = skip_index_.segments.front().get();
+                segment->first = node;
+            } else {
+                skip_index_.segments.push_back(std::make_unique<IndexSegment>());
+                segment = skip_index_.segments.back().get();
+                segment->first = node;
+            }
+            node->segment = segment;
+            ++segment->count;
+            if (!IsSkipIndexBalanced()) {
+                // Участков стало слишком много для прежней длины: деление стоило бы O(N) на вставку
+                UpdateSkipIndex();
+            } else if (segment->count > 2 * skip_index_.segment_size) {
+                SplitSegment(*segment);
+            }
+        } catch (...) {
+            InvalidateSkipIndex();
+        }
+    }
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::SkipIndexErase(Node* node) noexcept {
+    if constexpr (MAINTAINS_SKIP_INDEX) {
+        if (!skip_index_.is_valid) {
+            return;
+        }
+        IndexSegment* segment = node->segment;
+        if (--segment->count == 0) {
+            const size_t index = segment->index;
+            skip_index_.segments.erase(skip_index_.segments.begin() + index);
+            RenumberSegments(index);
+        } else if (segment->first == node) {
+            // Узлы участка идут подряд, поэтому следующий узел принадлежит тому же участку
+            segment->first = node->next_node;
+        }
+    }
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::SplitSegment(IndexSegment& segment) {
+    auto& segments = skip_index_.segments;
+    segments.insert(segments.begin() + segment.index + 1, std::make_unique<IndexSegment>());
+    IndexSegment& second = *segments[segment.index + 1];
+    const size_t kept = segment.count / 2;
+    Node* node = segment.first;
+    for (size_t i = 0; i < kept; ++i) {
+        node = node->next_node;
+    }
+    second.first = node;
+    second.count = segment.count - kept;
+    segment.count = kept;
+    for (size_t i = 0; i < second.count; ++i) {
+        node->segment = &second;
+        node = node->next_node;
+    }
+    RenumberSegments(segment.index + 1);
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::RenumberSegments(size_t from) noexcept {
+    auto& segments = skip_index_.segments;
+    for (size_t i = from; i < segments.size(); ++i) {
+        segments[i]->index = i;
+    }
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::InvalidateSkipIndex() noexcept {
+    if constexpr (MAINTAINS_SKIP_INDEX) {
+        skip_index_.segments.clear();
+        skip_index_.is_valid = false;
+    }
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::ResetSkipIndex() noexcept {
+    if constexpr (MAINTAINS_SKIP_INDEX) {
+        skip_index_.segments.clear();
+        skip_index_.is_valid = true;
+    }
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+size_t SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::GetIndexSegmentSize(size_t size) noexcept {
+    return std::max(MIN_INDEX_SEGMENT_SIZE, static_cast<size_t>(std::sqrt(static_cast<double>(size))));
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+bool SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::IsSkipIndexBalanced() const noexcept {
+    const size_t segment_size = GetIndexSegmentSize(size_);
+    // После перестройки участков не больше size_ / segment_size + 1, и каждый не длиннее segment_size.
+    // Индекс разбалансирован, когда одна из этих оценок нарушена вдвое
+    return skip_index_.is_valid && skip_index_.segment_size <= 2 * segment_size
+           && skip_index_.segments.size() <= 2 * (size_ / segment_size + 1);
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::UpdateSkipIndex() const {
+    if (IsSkipIndexBalanced()) {
+        return;
+    }
+    const size_t segment_size = GetIndexSegmentSize(size_);
+    // Новые участки выделяются заранее: если памяти не хватит, прежний индекс останется нетронутым
+    const size_t count = (size_ + segment_size - 1) / segment_size;
+    std::vector<std::unique_ptr<IndexSegment>> segments;
+    segments.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        segments.push_back(std::make_unique<IndexSegment>());
+    }
+    Node* node = head_.next_node;
+    for (size_t i = 0; i < count; ++i) {
+        IndexSegment& segment = *segments[i];
+        segment.first = node;
+        segment.count = std::min(segment_size, size_ - i * segment_size);
+        segment.index = i;
+        for (size_t j = 0; j < segment.count; ++j) {
+            node->segment = &segment;
+            node = node->next_node;
+        }
+    }
+    skip_index_.segments = std::move(segments);
+    skip_index_.segment_size = segment_size;
+    skip_index_.is_valid = true;
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+size_t SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::GetIndexOf(const Node* node) const noexcept {
+    const IndexSegment& segment = *node->segment;
+    size_t index = 0;
+    for (size_t i = 0; i < segment.index; ++i) {
+        index += skip_index_.segments[i]->count;
+    }
+    for (const Node* current = segment.first; current != node; current = current->next_node) {
+        ++index;
+    }
+    return index;
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+typename SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::Node* SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::FindNode(size_t index) const noexcept {
+    assert(index < size_);
+    for (const auto& segment : skip_index_.segments) {
+        if (index < segment->count) {
+            Node* node = segment->first;
+            CountTraversal(index);
+            for (; index > 0; --index) {
+                node = node->next_node;
+            }
+            return node;
+        }
+        index -= segment->count;
+    }
+    assert(false);
+    return nullptr;
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+template <typename Compare>
+typename SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::Node* SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::FindLastLess(const Type& value, Compare& comp) const {
+    const auto& segments = skip_index_.segments;
+    // Первые элементы участков отсортированы, поэтому первый участок, начинающийся
+    // не с меньшего элемента, находится двоичным поиском. Искомый узел - в предыдущем участке
+    const auto found = std::partition_point(segments.begin(), segments.end(),
+                                            [&value, &comp](const std::unique_ptr<IndexSegment>& segment) {
+                                                return comp(segment->first->value, value);
+                                            });
+    if (found == segments.begin()) {
+        return nullptr;
+    }
+    const IndexSegment& segment = **std::prev(found);
+    Node* node = segment.first;
+    size_t i = 1;
+    for (; i < segment.count && comp(node->next_node->value, value); ++i) {
+        node = node->next_node;
+    }
+    CountTraversal(i - 1);
+    return node;
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+typename SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::ElementReference SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::At(size_t index) {
+    static_assert(MAINTAINS_SKIP_INDEX, "At requires SkipIndex policy");
+    if (index >= size_) {
+        throw std::out_of_range("SingleLinkedList::At: index is out of range");
+    }
+    UpdateSkipIndex();
+    return FindNode(index)->value;
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+const Type& SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::At(size_t index) const {
+    static_assert(MAINTAINS_SKIP_INDEX, "At requires SkipIndex policy");
+    if (index >= size_) {
+        throw std::out_of_range("SingleLinkedList::At: index is out of range");
+    }
+    UpdateSkipIndex();
+    return FindNode(index)->value;
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+typename SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::Iterator SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::Advance(ConstIterator pos, size_t count) {
+    const ConstIterator result = std::as_const(*this).Advance(pos, count);
+    return MakeIterator(result.node_);
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+typename SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::ConstIterator SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::Advance(ConstIterator pos, size_t count) const {
+    static_assert(MAINTAINS_SKIP_INDEX, "Advance requires SkipIndex policy");
+    assert(pos.node_ != nullptr);
+    const NodeBase* node = pos.node_;
+    if (count <= 2 * skip_index_.segment_size) {
+        CountTraversal(count);
+        for (; count > 0; --count) {
+            assert(node != nullptr);
+            node = node->next_node;
+        }
+        return MakeConstIterator(node);
+    }
+    UpdateSkipIndex();
+    // Номер элемента, следующего за pos
+    const size_t start = node == &head_ ? 0 : GetIndexOf(static_cast<const Node*>(node)) + 1;
+    assert(start + count <= size_ + 1);
+    const size_t target = start + count - 1;
+    return MakeConstIterator(target == size_ ? nullptr : FindNode(target));
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+template <typename Compare>
+typename SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::Iterator SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::LowerBound(const Type& value, Compare comp) {
+    return MakeIterator(std::as_const(*this).LowerBound(value, comp).node_);
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+template <typename Compare>
+typename SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::ConstIterator SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::LowerBound(const Type& value, Compare comp) const {
+    static_assert(MAINTAINS_SKIP_INDEX, "LowerBound requires SkipIndex policy");
+    UpdateSkipIndex();
+    const Node* before = FindLastLess(value, comp);
+    return MakeConstIterator(before == nullptr ? head_.next_node : before->next_node);
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+template <typename Compare>
+typename SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::Iterator SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::LowerBoundBefore(const Type& value, Compare comp) {
+    return MakeIterator(std::as_const(*this).LowerBoundBefore(value, comp).node_);
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+template <typename Compare>
+typename SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::ConstIterator SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::LowerBoundBefore(const Type& value, Compare comp) const {
+    static_assert(MAINTAINS_SKIP_INDEX, "LowerBoundBefore requires SkipIndex policy");
+    UpdateSkipIndex();
+    const Node* before = FindLastLess(value, comp);
+    return MakeConstIterator(before == nullptr ? &head_ : before);
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+size_t SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::DestroyChain(Node* first, Node* last) noexcept {
+    size_t count = 0;
+    while (first != last) {
+        Node* next = first->next_node;
+        DestroyNode(first);
+        first = next;
+        ++count;
+    }
+    return count;
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+template <typename It, typename Sentinel>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::MakeList(It first, Sentinel last) {
+    assert(head_.next_node == nullptr);
+    if (first != last) {
+        LinkChainAfter(&head_, MakeChain(std::move(first), last));
+    }
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+template <typename It, typename>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::Assign(It first, It last) {
+    InvalidateFingerprint();
+    InvalidateSkipIndex();
+    NodeBase* prev = &head_;
+    size_t assigned = 0;
+    // Перезаписываем значения существующих узлов
+    for (; first != last && prev->next_node != nullptr; ++first) {
+        prev->next_node->value = *first;
+        prev = prev->next_node;
+        ++assigned;
+    }
+    if (first != last) {
+        // Недостающие узлы присоединяются к концу списка одной записью указателя
+        size_ = assigned;
+        LinkChainAfter(prev, MakeChain(first, last));
+    } else {
+        // Лишние узлы удаляются
+        Node* rest = prev->next_node;
+        prev->next_node = nullptr;
+        DestroyChain(rest);
+        size_ = assigned;
+        UpdateSizeStatistics();
+        if constexpr (TRACKS_TAIL) {
+            tail_ = ToNode(prev);
+        }
+    }
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::Assign(std::initializer_list<Type> values) {
+    Assign(values.begin(), values.end());
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+template <typename... Args>
+typename SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::Node* SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::CreateNode(Node* next, Args&&... args) {
+    Node* node = AllocateNode();
+    try {
+        NodeAllocTraits::construct(node_alloc_, node, std::in_place, next, std::forward<Args>(args)...);
+    } catch (...) {
+        DeallocateNode(node);
+        throw;
+    }
+    return node;
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::DestroyNode(Node* node) noexcept {
+    NodeAllocTraits::destroy(node_alloc_, node);
+    DeallocateNode(node);
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+typename SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::Node* SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::AllocateNode() {
+    if constexpr (RESERVES_NODES) {
+        if (Node* node = spares_.first) {
+            spares_.first = std::launder(reinterpret_cast<SpareNode*>(node))->next;
+            --spares_.count;
+            return node;
+        }
+    }
+    Node* node = NodeAllocTraits::allocate(node_alloc_, 1);
+    if constexpr (COLLECTS_STATISTICS) {
+        statistics_.OnAllocate();
+    }
+    return node;
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::DeallocateNode(Node* node) noexcept {
+    if constexpr (RESERVES_NODES) {
+        if (spares_.count < spares_.limit) {
+            ::new (static_cast<void*>(node)) SpareNode{spares_.first};
+            spares_.first = node;
+            ++spares_.count;
+            return;
+        }
+    }
+    NodeAllocTraits::deallocate(node_alloc_, node, 1);
+    if constexpr (COLLECTS_STATISTICS) {
+        statistics_.OnDeallocate();
+    }
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::ReleaseSpareNodes() noexcept {
+    if constexpr (RESERVES_NODES) {
+        while (Node* node = spares_.first) {
+            spares_.first = std::launder(reinterpret_cast<SpareNode*>(node))->next;
+            NodeAllocTraits::deallocate(node_alloc_, node, 1);
+            if constexpr (COLLECTS_STATISTICS) {
+                statistics_.OnDeallocate();
+            }
+        }
+        spares_.count = 0;
+    }
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::Reserve(size_t capacity) {
+    static_assert(RESERVES_NODES, "Reserve requires NodeReserve policy");
+    spares_.limit = std::max(spares_.limit, capacity);
+    while (size_ + spares_.count < capacity) {
+        Node* node = NodeAllocTraits::allocate(node_alloc_, 1);
+        if constexpr (COLLECTS_STATISTICS) {
+            statistics_.OnAllocate();
+        }
+        ::new (static_cast<void*>(node)) SpareNode{spares_.first};
+        spares_.first = node;
+        ++spares_.count;
+    }
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::ShrinkToFit() noexcept {
+    static_assert(RESERVES_NODES, "ShrinkToFit requires NodeReserve policy");
+    ReleaseSpareNodes();
+    spares_.limit = 0;
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+size_t SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::GetCapacity() const noexcept {
+    static_assert(RESERVES_NODES, "GetCapacity requires NodeReserve policy");
+    return size_ + spares_.count;
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::StealNodes(SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>& other) noexcept {
+    head_.next_node = other.head_.next_node;
+    size_ = other.size_;
+    tail_ = other.tail_;
+    other.head_.next_node = nullptr;
+    other.size_ = 0;
+    other.tail_ = {};
+    UpdateSizeStatistics();
+    other.UpdateSizeStatistics();
+    fingerprint_ = other.fingerprint_;
+    other.ResetFingerprint();
+    skip_index_ = std::move(other.skip_index_);
+    other.ResetSkipIndex();
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::PushFront(const Type& value) {
+    EmplaceFront(value);
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::PushFront(Type&& value) {
+    EmplaceFront(std::move(value));
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+template <typename It, typename>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::PushFrontBatch(It first, It last) {
+    if (first != last) {
+        LinkChainAfter(&head_, MakeChain(first, last));
+    }
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+template <typename... Args>
+typename SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::ElementReference SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::EmplaceFront(Args&&... args) {
+	head_.next_node = CreateNode(head_.next_node, std::forward<Args>(args)...);
+	++size_;
+    UpdateSizeStatistics();
+    FingerprintPushFront(head_.next_node->value);
+    SkipIndexInsert(&head_, head_.next_node);
+    if constexpr (TRACKS_TAIL) {
+        if (head_.next_node->next_node == nullptr) {
+            tail_ = head_.next_node;
+        }
+    }
+    return head_.next_node->value;
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::PushBack(const Type& value) {
+    EmplaceBack(value);
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::PushBack(Type&& value) {
+    EmplaceBack(std::move(value));
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+template <typename... Args>
+typename SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::ElementReference SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::EmplaceBack(Args&&... args) {
+    static_assert(TRACKS_TAIL, "EmplaceBack requires TailTracking policy");
+    Node* node = CreateNode(nullptr, std::forward<Args>(args)...);
+    NodeBase* prev = tail_ ? static_cast<NodeBase*>(tail_) : &head_;
+    prev->next_node = node;
+    tail_ = node;
+    ++size_;
+    UpdateSizeStatistics();
+    FingerprintPushBack(node->value);
+    SkipIndexInsert(prev, node);
+    return node->value;
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+typename SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::ElementReference SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::Back() noexcept {
+    static_assert(TRACKS_TAIL, "Back requires TailTracking policy");
+    assert(size_ > 0);
+    return tail_->value;
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+const Type& SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::Back() const noexcept {
+    static_assert(TRACKS_TAIL, "Back requires TailTracking policy");
+    assert(size_ > 0);
+    return tail_->value;
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::SpliceBack(SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>& other) noexcept {
+    static_assert(TRACKS_TAIL, "SpliceBack requires TailTracking policy");
+    assert(node_alloc_ == other.node_alloc_);
+    if (this == &other || other.IsEmpty()) {
+        return;
+    }
+    if (tail_) {
+        tail_->next_node = other.head_.next_node;
+    } else {
+        head_.next_node = other.head_.next_node;
+    }
+    tail_ = other.tail_;
+    size_ += other.size_;
+    other.head_.next_node = nullptr;
+    other.tail_ = nullptr;
+    other.size_ = 0;
+    UpdateSizeStatistics();
+    other.UpdateSizeStatistics();
+    InvalidateFingerprint();
+    InvalidateSkipIndex();
+    other.ResetFingerprint();
+    other.ResetSkipIndex();
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::SpliceBack(SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>&& other) noexcept {
+    SpliceBack(other);
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::Clear() noexcept {
+    if (TryReleaseAll(false)) {
+        return;
+    }
+    DestroyChain(head_.next_node);
+    head_.next_node = nullptr;
+    size_ = 0;
+    tail_ = {};
+    UpdateSizeStatistics();
+    ResetFingerprint();
+    ResetSkipIndex();
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::ClearAsync() noexcept {
+    if (!TryReleaseAll(true)) {
+        Clear();
+    }
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::Reverse() noexcept {
+    Node* reversed = nullptr;
+    Node* node = head_.next_node;
+    if constexpr (TRACKS_TAIL) {
+        tail_ = node;
+    }
+    while (node != nullptr) {
+        Node* next = node->next_node;
+        node->next_node = reversed;
+        reversed = node;
+        node = next;
+    }
+    head_.next_node = reversed;
+    InvalidateFingerprint();
+    InvalidateSkipIndex();
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::RotateLinks(NodeBase* before, NodeBase* middle, Node* last_moved) noexcept {
+    Node* first_kept = before->next_node;
+    before->next_node = middle->next_node;
+    middle->next_node = last_moved->next_node;
+    last_moved->next_node = first_kept;
+    if constexpr (TRACKS_TAIL) {
+        if (middle->next_node == nullptr) {
+            tail_ = static_cast<Node*>(middle);
+        }
+    }
+    InvalidateFingerprint();
+    InvalidateSkipIndex();
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::RotateAfter(ConstIterator first, ConstIterator middle, ConstIterator last) noexcept {
+    assert(first.node_ != nullptr && middle.node_ != nullptr);
+    if (middle.node_ == first.node_ || middle.node_->next_node == last.node_) {
+        return;
+    }
+    Node* last_moved = middle.node_->next_node;
+    while (last_moved->next_node != last.node_) {
+        last_moved = last_moved->next_node;
+    }
+    RotateLinks(first.node_, middle.node_, last_moved);
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::RotateAfter(ConstIterator middle) noexcept {
+    assert(middle.node_ != nullptr);
+    if (middle.node_ == &head_ || middle.node_->next_node == nullptr) {
+        return;
+    }
+    Node* last_moved = nullptr;
+    if constexpr (TRACKS_TAIL) {
+        last_moved = tail_;
+    } else {
+        last_moved = middle.node_->next_node;
+        while (last_moved->next_node != nullptr) {
+            last_moved = last_moved->next_node;
+        }
+    }
+    RotateLinks(&head_, middle.node_, last_moved);
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy> SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::SplitAfter(ConstIterator pos) {
+    assert(pos.node_ != nullptr);
+    SingleLinkedList result((allocator_type(node_alloc_)));
+    Chain chain;
+    chain.first = pos.node_->next_node;
+    if (chain.first == nullptr) {
+        return result;
+    }
+    if (pos.node_ == &head_) {
+        // Весь список переходит в result вместе с отпечатком и индексом
+        result.StealNodes(*this);
+        return result;
+    }
+    chain.size = 1;
+    for (chain.last = chain.first; chain.last->next_node != nullptr; chain.last = chain.last->next_node) {
+        ++chain.size;
+    }
+    pos.node_->next_node = nullptr;
+    size_ -= chain.size;
+    if constexpr (TRACKS_TAIL) {
+        tail_ = ToNode(pos.node_);
+    }
+    UpdateSizeStatistics();
+    InvalidateFingerprint();
+    InvalidateSkipIndex();
+    result.LinkChainAfter(&result.head_, chain);
+    return result;
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+std::vector<SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>> SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::SplitEvery(size_t count) {
+    assert(count > 0);
+    // Пустые части создаются заранее, чтобы разрезание не выбрасывало исключений
+    std::vector<SingleLinkedList> parts;
+    const size_t part_count = (size_ + count - 1) / count;
+    parts.reserve(part_count);
+    for (size_t i = 0; i < part_count; ++i) {
+        parts.emplace_back(allocator_type(node_alloc_));
+    }
+    Node* node = std::exchange(head_.next_node, nullptr);
+    for (SingleLinkedList& part : parts) {
+        Chain chain;
+        chain.first = node;
+        chain.last = node;
+        chain.size = 1;
+        for (; chain.size < count && chain.last->next_node != nullptr; ++chain.size) {
+            chain.last = chain.last->next_node;
+        }
+        node = std::exchange(chain.last->next_node, nullptr);
+        part.LinkChainAfter(&part.head_, chain);
+    }
+    size_ = 0;
+    tail_ = {};
+    UpdateSizeStatistics();
+    ResetFingerprint();
+    ResetSkipIndex();
+    return parts;
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+bool SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::TryReleaseAll(bool async) noexcept {
+    if constexpr (std::is_trivially_destructible_v<Node> && SUPPORTS_BULK_RELEASE<NodeAllocator>) {
+        if (size_ == 0) {
+            return false;
+        }
+        if constexpr (RESERVES_NODES) {
+            // Узлы должны вернуться в запас, а не пропасть вместе с ареной
+            if (spares_.limit > 0) {
+                return false;
+            }
+        }
+        // Аллокатор освободит память, только если все его живые блоки - узлы этого списка
+        const bool released = async ? node_alloc_.ReleaseAllAsync(size_) : node_alloc_.ReleaseAll(size_);
+        if (!released) {
+            return false;
+        }
+        if constexpr (COLLECTS_STATISTICS) {
+            statistics_.OnDeallocate(size_);
+        }
+        head_.next_node = nullptr;
+        size_ = 0;
+        tail_ = {};
+        UpdateSizeStatistics();
+        ResetFingerprint();
+        ResetSkipIndex();
+        return true;
+    } else {
+        (void)async;
+        return false;
+    }
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::swap(SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>& other) noexcept {
+	Node* next_node = head_.next_node;
+	size_t t_size = size_;
+        
+	size_ = other.size_;
+	head_.next_node = other.head_.next_node;
+        
+	other.size_ = t_size;
+	other.head_.next_node = next_node;
+
+    std::swap(tail_, other.tail_);
+    std::swap(spares_, other.spares_);
+    std::swap(fingerprint_, other.fingerprint_);
+    std::swap(skip_index_, other.skip_index_);
+    UpdateSizeStatistics();
+    other.UpdateSizeStatistics();
+
+    // Аллокаторы обмениваются, только если этого требуют их свойства.
+    // Иначе, как и у стандартных контейнеров, аллокаторы списков должны быть равны
+    if constexpr (NodeAllocTraits::propagate_on_container_swap::value) {
+        using std::swap;
+        swap(node_alloc_, other.node_alloc_);
+    }
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::PopFront() noexcept {
+    assert(size_ > 0);
+    FingerprintPopFront(head_.next_node->value);
+    SkipIndexErase(head_.next_node);
+	Node* tmp = head_.next_node->next_node;
+	DestroyNode(head_.next_node);
+	head_.next_node = tmp;
+	--size_;
+    UpdateSizeStatistics();
+    if constexpr (TRACKS_TAIL) {
+        if (tmp == nullptr) {
+            tail_ = nullptr;
+        }
+    }
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+template <typename OutputIt>
+OutputIt SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::PopFrontN(size_t count, OutputIt out) {
+    count = std::min(count, size_);
+    Node* node = head_.next_node;
+    size_t popped = 0;
+    // Присоединяет оставшиеся узлы к head_ и учитывает удалённые
+    const auto detach = [&]() noexcept {
+        head_.next_node = node;
+        size_ -= popped;
+        UpdateSizeStatistics();
+        InvalidateFingerprint();
+        InvalidateSkipIndex();
+        if constexpr (TRACKS_TAIL) {
+            if (node == nullptr) {
+                tail_ = nullptr;
+            }
+        }
+    };
+    try {
+        for (; popped < count; ++popped) {
+            *out = std::move(node->value);
+            ++out;
+            Node* next = node->next_node;
+            DestroyNode(node);
+            node = next;
+        }
+    } catch (...) {
+        detach();
+        throw;
+    }
+    detach();
+    return out;
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>& SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::operator=(const SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>& rhs) {
+    if(this != &rhs){
+        constexpr bool propagate = NodeAllocTraits::propagate_on_container_copy_assignment::value;
+        SingleLinkedList rhs_copy(rhs, propagate ? rhs.node_alloc_ : node_alloc_);
+        std::swap(head_.next_node, rhs_copy.head_.next_node);
+        std::swap(size_, rhs_copy.size_);
+        std::swap(tail_, rhs_copy.tail_);
+        std::swap(fingerprint_, rhs_copy.fingerprint_);
+        std::swap(skip_index_, rhs_copy.skip_index_);
+        UpdateSizeStatistics();
+        if constexpr (propagate) {
+            // Запас выделен прежним аллокатором и разрушается вместе с ним в rhs_copy
+            std::swap(spares_, rhs_copy.spares_);
+            using std::swap;
+            swap(node_alloc_, rhs_copy.node_alloc_);
+        }
+    }
+    return *this;
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>& SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::operator=(SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>&& rhs) noexcept(
+    NodeAllocTraits::propagate_on_container_move_assignment::value || NodeAllocTraits::is_always_equal::value) {
+    if(this != &rhs){
+        constexpr bool propagate = NodeAllocTraits::propagate_on_container_move_assignment::value;
+        if constexpr (propagate || NodeAllocTraits::is_always_equal::value) {
+            Clear();
+            if constexpr (propagate) {
+                // Узлы запаса нужно вернуть аллокатору, которым они выделены
+                ReleaseSpareNodes();
+                node_alloc_ = std::move(rhs.node_alloc_);
+            }
+            StealNodes(rhs);
+        } else if (node_alloc_ == rhs.node_alloc_) {
+            Clear();
+            StealNodes(rhs);
+        } else {
+            SingleLinkedList rhs_copy((allocator_type(node_alloc_)));
+            rhs_copy.MakeList(std::make_move_iterator(rhs.begin()), std::make_move_iterator(rhs.end()));
+            std::swap(head_.next_node, rhs_copy.head_.next_node);
+            std::swap(size_, rhs_copy.size_);
+            std::swap(tail_, rhs_copy.tail_);
+            std::swap(fingerprint_, rhs_copy.fingerprint_);
+            std::swap(skip_index_, rhs_copy.skip_index_);
+            UpdateSizeStatistics();
+            rhs.Clear();
+        }
+    }
+    return *this;
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+template <typename Compare>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::SortChain(NodeBase& head, Compare& comp) {
+    // buckets[i] хранит отсортированную цепочку из 2^i узлов либо nullptr.
+    // Чем больше i, тем раньше в исходном списке стояли узлы цепочки
+    constexpr size_t MAX_BUCKETS = sizeof(size_t) * 8;
+    Node* buckets[MAX_BUCKETS] = {};
+    size_t bucket_count = 0;
+    Node* carry = nullptr;
+    try {
+        while (head.next_node != nullptr) {
+            carry = head.next_node;
+            head.next_node = carry->next_node;
+            carry->next_node = nullptr;
+
+            size_t i = 0;
+            while (buckets[i] != nullptr) {
+                MergeChains(buckets[i], std::exchange(carry, nullptr), comp);
+                carry = std::exchange(buckets[i], nullptr);
+                ++i;
+            }
+            buckets[i] = std::exchange(carry, nullptr);
+            bucket_count = std::max(bucket_count, i + 1);
+        }
+        Node* result = nullptr;
+        for (size_t i = 0; i < bucket_count; ++i) {
+            if (buckets[i] != nullptr) {
+                MergeChains(buckets[i], result, comp);
+                result = std::exchange(buckets[i], nullptr);
+            }
+        }
+        head.next_node = result;
+    } catch (...) {
+        // Возвращаем в список все узлы: необработанные, переносимую цепочку и содержимое корзин
+        NodeBase* tail = &head;
+        while (tail->next_node != nullptr) {
+            tail = tail->next_node;
+        }
+        tail->next_node = carry;
+        for (size_t i = 0; i < bucket_count; ++i) {
+            while (tail->next_node != nullptr) {
+                tail = tail->next_node;
+            }
+            tail->next_node = buckets[i];
+        }
+        throw;
+    }
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+template <typename Compare>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::Sort(Compare comp) {
+    InvalidateFingerprint();
+    InvalidateSkipIndex();
+    try {
+        SortChain(head_, comp);
+    } catch (...) {
+        UpdateTail();
+        throw;
+    }
+    UpdateTail();
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+template <typename Compare>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::Merge(SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>& other, Compare comp) {
+    assert(this != &other);
+    assert(node_alloc_ == other.node_alloc_);
+    const size_t other_size = std::exchange(other.size_, 0);
+    other.tail_ = {};
+    other.UpdateSizeStatistics();
+    other.ResetFingerprint();
+    other.ResetSkipIndex();
+    InvalidateFingerprint();
+    InvalidateSkipIndex();
+    CountTraversal(size_ + other_size);
+    try {
+        MergeChains(head_.next_node, std::exchange(other.head_.next_node, nullptr), comp);
+    } catch (...) {
+        size_ += other_size;
+        UpdateSizeStatistics();
+        UpdateTail();
+        throw;
+    }
+    size_ += other_size;
+    UpdateSizeStatistics();
+    UpdateTail();
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+template <typename Compare>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::Merge(SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>&& other, Compare comp) {
+    Merge(other, comp);
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+template <typename BinaryPredicate>
+size_t SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::Unique(BinaryPredicate pred) {
+    if (head_.next_node == nullptr) {
+        return 0;
+    }
+    InvalidateFingerprint();
+    InvalidateSkipIndex();
+    CountTraversal(size_);
+    Chain removed;
+    Node* kept = head_.next_node;
+    try {
+        while (kept->next_node != nullptr) {
+            Node* current = kept->next_node;
+            if (pred(kept->value, current->value)) {
+                kept->next_node = current->next_node;
+                AttachToChain(removed, current);
+            } else {
+                kept = current;
+            }
+        }
+    } catch (...) {
+        size_ -= DestroyChain(removed.first);
+        UpdateSizeStatistics();
+        throw;
+    }
+    if constexpr (TRACKS_TAIL) {
+        tail_ = kept;
+    }
+    size_ -= DestroyChain(removed.first);
+    UpdateSizeStatistics();
+    return removed.size;
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+template <typename UnaryPredicate>
+size_t SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::RemoveIf(UnaryPredicate pred) {
+    InvalidateFingerprint();
+    InvalidateSkipIndex();
+    CountTraversal(size_);
+    Chain removed;
+    NodeBase* kept = &head_;
+    try {
+        while (kept->next_node != nullptr) {
+            Node* current = kept->next_node;
+            if (pred(current->value)) {
+                kept->next_node = current->next_node;
+                AttachToChain(removed, current);
+            } else {
+                kept = current;
+            }
+        }
+    } catch (...) {
+        size_ -= DestroyChain(removed.first);
+        UpdateSizeStatistics();
+        throw;
+    }
+    if constexpr (TRACKS_TAIL) {
+        tail_ = ToNode(kept);
+    }
+    size_ -= DestroyChain(removed.first);
+    UpdateSizeStatistics();
+    return removed.size;
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+size_t SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::Remove(const Type& value) {
+    return RemoveIf([&value](const Type& item) {
+        return item == value;
+    });
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::Prefetch(const NodeBase* node) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(node);
+#else
+    (void)node;
+#endif
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+template <typename Self, typename Function>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::ForEachNode(Self& self, Function& f) {
+    self.CountTraversal(self.size_);
+    for (auto* node = self.head_.next_node; node != nullptr;) {
+        auto* next = node->next_node;
+        // Prefetch(nullptr) не обращается к памяти, поэтому проверка не нужна
+        Prefetch(next);
+        f(node->value);
+        node = next;
+    }
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+template <size_t ChunkSize, typename Self, typename Function>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::ForEachNodeChunked(Self& self, Function& f) {
+    static_assert(ChunkSize > 0, "ChunkSize must be positive");
+    using Pointer = std::conditional_t<std::is_const_v<Self>, const Type*, Type*>;
+    Pointer items[ChunkSize];
+    self.CountTraversal(self.size_);
+    auto* node = self.head_.next_node;
+    while (node != nullptr) {
+        size_t count = 0;
+        for (; node != nullptr && count < ChunkSize; node = node->next_node) {
+            items[count++] = &node->value;
+        }
+        // Следующая порция начинает загружаться, пока f обрабатывает текущую
+        Prefetch(node);
+        f(static_cast<const Pointer*>(items), count);
+    }
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+template <typename Function>
+Function SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::ForEach(Function f) {
+    if constexpr (MAINTAINS_FINGERPRINT) {
+        ForEachNode(std::as_const(*this), f);
+    } else {
+        ForEachNode(*this, f);
+    }
+    return f;
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+template <typename Function>
+Function SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::ForEach(Function f) const {
+    ForEachNode(*this, f);
+    return f;
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+template <size_t ChunkSize, typename Function>
+Function SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::ForEachChunked(Function f) {
+    if constexpr (MAINTAINS_FINGERPRINT) {
+        ForEachNodeChunked<ChunkSize>(std::as_const(*this), f);
+    } else {
+        ForEachNodeChunked<ChunkSize>(*this, f);
+    }
+    return f;
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+template <size_t ChunkSize, typename Function>
+Function SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::ForEachChunked(Function f) const {
+    ForEachNodeChunked<ChunkSize>(*this, f);
+    return f;
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+template <typename Value, typename BinaryOperation>
+Value SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::Accumulate(Value init, BinaryOperation op) const {
+    ForEach([&init, &op](const Type& value) {
+        init = op(std::move(init), value);
+    });
+    return init;
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+size_t SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::GetParallelSegmentCount(size_t thread_count) const noexcept {
+    if (thread_count == 0) {
+        thread_count = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+    return std::max<size_t>(std::min(thread_count, size_ / PARALLEL_MIN_SEGMENT_SIZE), 1);
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+size_t SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::GetSegmentSize(size_t index, size_t count) const noexcept {
+    return size_ / count + (index < size_ % count ? 1 : 0);
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+std::vector<typename SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::Node*> SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::GetSegmentBounds(size_t count) const {
+    assert(count > 0 && count <= size_);
+    std::vector<Node*> bounds;
+    bounds.reserve(count + 1);
+    Node* node = head_.next_node;
+    for (size_t i = 0; i < count; ++i) {
+        bounds.push_back(node);
+        for (size_t j = GetSegmentSize(i, count); j > 0; --j) {
+            node = node->next_node;
+        }
+    }
+    bounds.push_back(nullptr);
+    return bounds;
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+template <typename Task>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::RunInParallel(size_t count, Task& task) {
+    std::vector<std::exception_ptr> errors(count);
+    std::vector<std::thread> threads;
+    threads.reserve(count - 1);
+    auto run = [&task, &errors](size_t i) noexcept {
+        try {
+            task(i);
+        } catch (...) {
+            errors[i] = std::current_exception();
+        }
+    };
+    for (size_t i = 1; i < count; ++i) {
+        try {
+            threads.emplace_back(run, i);
+        } catch (...) {
+            run(i);
+        }
+    }
+    run(0);
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    for (const std::exception_ptr& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+template <typename Self, typename Function>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::ParallelForEachNode(Self& self, Function& f, size_t thread_count) {
+    const size_t count = self.GetParallelSegmentCount(thread_count);
+    if (count == 1) {
+        ForEachNode(self, f);
+        return;
+    }
+    self.CountTraversal(self.size_);
+    const std::vector<Node*> bounds = self.GetSegmentBounds(count);
+    auto task = [&bounds, &f](size_t i) {
+        for (Node* node = bounds[i]; node != bounds[i + 1]; node = node->next_node) {
+            if constexpr (std::is_const_v<Self>) {
+                f(std::as_const(node->value));
+            } else {
+                f(node->value);
+            }
+        }
+    };
+    RunInParallel(count, task);
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+template <typename Function>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::ParallelForEach(Function f, size_t thread_count) {
+    if constexpr (MAINTAINS_FINGERPRINT) {
+        ParallelForEachNode(std::as_const(*this), f, thread_count);
+    } else {
+        ParallelForEachNode(*this, f, thread_count);
+    }
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+template <typename Function>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::ParallelForEach(Function f, size_t thread_count) const {
+    ParallelForEachNode(*this, f, thread_count);
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+template <typename Value, typename BinaryOperation>
+Value SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::ParallelReduce(Value init, BinaryOperation op, size_t thread_count) const {
+    const size_t count = GetParallelSegmentCount(thread_count);
+    if (count == 1) {
+        return Accumulate(std::move(init), op);
+    }
+    CountTraversal(size_);
+    const std::vector<Node*> bounds = GetSegmentBounds(count);
+    std::vector<std::optional<Value>> partials(count);
+    auto task = [&bounds, &partials, &op](size_t i) {
+        BinaryOperation segment_op = op;
+        Value partial = static_cast<Value>(std::as_const(bounds[i]->value));
+        for (Node* node = bounds[i]->next_node; node != bounds[i + 1]; node = node->next_node) {
+            partial = segment_op(std::move(partial), std::as_const(node->value));
+        }
+        partials[i].emplace(std::move(partial));
+    };
+    RunInParallel(count, task);
+    for (std::optional<Value>& partial : partials) {
+        init = op(std::move(init), std::move(*partial));
+    }
+    return init;
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+template <typename Compare>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::ParallelSort(Compare comp, size_t thread_count) {
+    const size_t count = GetParallelSegmentCount(thread_count);
+    if (count == 1) {
+        Sort(comp);
+        return;
+    }
+    InvalidateFingerprint();
+    InvalidateSkipIndex();
+    std::vector<NodeBase> chains(count);
+    // За один проход разрезаем список на цепочки, каждая заканчивается nullptr
+    Node* node = std::exchange(head_.next_node, nullptr);
+    for (size_t i = 0; i < count; ++i) {
+        chains[i].next_node = node;
+        for (size_t j = GetSegmentSize(i, count); j > 1; --j) {
+            node = node->next_node;
+        }
+        node = std::exchange(node->next_node, nullptr);
+    }
+    try {
+        auto sort_task = [&chains, &comp](size_t i) {
+            Compare segment_comp = comp;
+            SortChain(chains[i], segment_comp);
+        };
+        RunInParallel(count, sort_task);
+        // На уровне step сливаются цепочки i и i + step, где i кратно 2 * step
+        for (size_t step = 1; step < count; step *= 2) {
+            auto merge_task = [&chains, &comp, count, step](size_t j) {
+                const size_t i = j * 2 * step;
+                if (i + step < count) {
+                    Compare segment_comp = comp;
+                    MergeChains(chains[i].next_node, std::exchange(chains[i + step].next_node, nullptr), segment_comp);
+                }
+            };
+            RunInParallel((count + 2 * step - 1) / (2 * step), merge_task);
+        }
+    } catch (...) {
+        // Склеиваем цепочки обратно, чтобы ни один узел не потерялся
+        NodeBase* tail = &head_;
+        for (NodeBase& chain : chains) {
+            tail->next_node = chain.next_node;
+            while (tail->next_node != nullptr) {
+                tail = tail->next_node;
+            }
+        }
+        UpdateTail();
+        throw;
+    }
+    head_.next_node = chains[0].next_node;
+    UpdateTail();
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+Type SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::LoadValue(const unsigned char* bytes) noexcept {
+    static_assert(std::is_trivially_copyable_v<Type>, "Serialization requires a trivially copyable Type");
+    alignas(Type) unsigned char storage[sizeof(Type)];
+    std::memcpy(storage, bytes, sizeof(Type));
+    return *std::launder(reinterpret_cast<Type*>(storage));
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+size_t SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::GetSerializedSize() const noexcept {
+    return sizeof(std::uint64_t) + size_ * sizeof(Type);
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::Serialize(std::ostream& out) const {
+    static_assert(std::is_trivially_copyable_v<Type>, "Serialization requires a trivially copyable Type");
+    // Элементы копируются в буфер и записываются в поток крупными блоками
+    constexpr size_t BUFFER_SIZE = 4096;
+    unsigned char buffer[BUFFER_SIZE];
+    const std::uint64_t count = size_;
+    std::memcpy(buffer, &count, sizeof(count));
+    size_t used = sizeof(count);
+    for (const Node* node = head_.next_node; node != nullptr; node = node->next_node) {
+        if (used + sizeof(Type) > BUFFER_SIZE) {
+            out.write(reinterpret_cast<const char*>(buffer), static_cast<std::streamsize>(used));
+            used = 0;
+        }
+        if constexpr (sizeof(Type) > BUFFER_SIZE) {
+            out.write(reinterpret_cast<const char*>(&node->value), static_cast<std::streamsize>(sizeof(Type)));
+        } else {
+            std::memcpy(buffer + used, &node->value, sizeof(Type));
+            used += sizeof(Type);
+        }
+    }
+    out.write(reinterpret_cast<const char*>(buffer), static_cast<std::streamsize>(used));
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+size_t SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::Serialize(void* buffer, size_t buffer_size) const {
+    static_assert(std::is_trivially_copyable_v<Type>, "Serialization requires a trivially copyable Type");
+    const size_t serialized_size = GetSerializedSize();
+    if (buffer_size < serialized_size) {
+        throw std::length_error("SingleLinkedList::Serialize: buffer is too small");
+    }
+    auto* bytes = static_cast<unsigned char*>(buffer);
+    const std::uint64_t count = size_;
+    std::memcpy(bytes, &count, sizeof(count));
+    bytes += sizeof(count);
+    for (const Node* node = head_.next_node; node != nullptr; node = node->next_node) {
+        std::memcpy(bytes, &node->value, sizeof(Type));
+        bytes += sizeof(Type);
+    }
+    return serialized_size;
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy> SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::Deserialize(std::istream& in, const Allocator& alloc) {
+    SingleLinkedList list(alloc);
+    Deserializer deserializer(list);
+    constexpr size_t BUFFER_SIZE = 4096;
+    char buffer[BUFFER_SIZE];
+    while (!deserializer.IsComplete()) {
+        // Не читаем из потока байты, которые идут после списка
+        const size_t wanted = std::min(BUFFER_SIZE, deserializer.GetMissingBytes());
+        in.read(buffer, static_cast<std::streamsize>(wanted));
+        const auto received = static_cast<size_t>(in.gcount());
+        deserializer.Feed(buffer, received);
+        if (received < wanted) {
+            throw std::runtime_error("SingleLinkedList::Deserialize: unexpected end of stream");
+        }
+    }
+    return list;
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy> SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::Deserialize(const void* data, size_t size, const Allocator& alloc) {
+    SingleLinkedList list(alloc);
+    Deserializer deserializer(list);
+    deserializer.Feed(data, size);
+    if (!deserializer.IsComplete()) {
+        throw std::runtime_error("SingleLinkedList::Deserialize: unexpected end of data");
+    }
+    return list;
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::Deserializer::Deserializer(SingleLinkedList& list) noexcept
+    : list_(&list)
+    , last_(&list.head_) {
+    static_assert(std::is_trivially_copyable_v<Type>, "Serialization requires a trivially copyable Type");
+    if constexpr (TRACKS_TAIL) {
+        if (list.tail_ != nullptr) {
+            last_ = list.tail_;
+        }
+    } else {
+        while (last_->next_node != nullptr) {
+            last_ = last_->next_node;
+        }
+    }
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+size_t SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::Deserializer::FillPending(const unsigned char* data, size_t size, size_t need) noexcept {
+    const size_t count = std::min(size, need - pending_size_);
+    std::memcpy(pending_ + pending_size_, data, count);
+    pending_size_ += count;
+    return count;
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+size_t SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::Deserializer::Feed(const void* data, size_t size) {
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    size_t consumed = 0;
+    if (!has_header_) {
+        consumed += FillPending(bytes, size, sizeof(remaining_));
+        if (pending_size_ < sizeof(remaining_)) {
+            return consumed;
+        }
+        std::memcpy(&remaining_, pending_, sizeof(remaining_));
+        pending_size_ = 0;
+        has_header_ = true;
+    }
+    Chain chain;
+    try {
+        // Сначала дособираем элемент, начало которого пришло в прошлой порции
+        if (pending_size_ > 0) {
+            consumed += FillPending(bytes + consumed, size - consumed, sizeof(Type));
+            if (pending_size_ == sizeof(Type)) {
+                list_->AppendToChain(chain, LoadValue(pending_));
+                pending_size_ = 0;
+                --remaining_;
+            }
+        }
+        while (remaining_ > 0 && size - consumed >= sizeof(Type)) {
+            list_->AppendToChain(chain, LoadValue(bytes + consumed));
+            consumed += sizeof(Type);
+            --remaining_;
+        }
+        if (remaining_ > 0) {
+            consumed += FillPending(bytes + consumed, size - consumed, sizeof(Type));
+        }
+    } catch (...) {
+        if (chain.first != nullptr) {
+            list_->LinkChainAfter(last_, chain);
+            last_ = chain.last;
+        }
+        throw;
+    }
+    if (chain.first != nullptr) {
+        list_->LinkChainAfter(last_, chain);
+        last_ = chain.last;
+    }
+    return consumed;
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+bool SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::Deserializer::IsComplete() const noexcept {
+    return has_header_ && remaining_ == 0;
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+size_t SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::Deserializer::GetMissingBytes() const noexcept {
+    if (!has_header_) {
+        return sizeof(remaining_) - pending_size_;
+    }
+    if (remaining_ > (std::numeric_limits<size_t>::max() - sizeof(Type)) / sizeof(Type)) {
+        return std::numeric_limits<size_t>::max();
+    }
+    return static_cast<size_t>(remaining_) * sizeof(Type) - pending_size_;
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+bool SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::IsEmpty() const noexcept {
+    return size_ == 0;
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+size_t SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::GetSize() const noexcept {
+    return size_;
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+int SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::CompareTo(const SingleLinkedList& other) const {
+    const Node* lhs = head_.next_node;
+    const Node* rhs = other.head_.next_node;
+    // Сравнение обходит оба списка до первого различия, поэтому пройденные элементы
+    // учитываются в статистике обоих
+    size_t steps = 0;
+    int result = 0;
+    for (; lhs != nullptr && rhs != nullptr; lhs = lhs->next_node, rhs = rhs->next_node) {
+        ++steps;
+        if (lhs->value < rhs->value) {
+            result = -1;
+            break;
+        }
+        if (rhs->value < lhs->value) {
+            result = 1;
+            break;
+        }
+    }
+    if (result == 0 && (lhs != nullptr || rhs != nullptr)) {
+        result = lhs == nullptr ? -1 : 1;
+    }
+    CountTraversal(steps);
+    other.CountTraversal(steps);
+    return result;
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+size_t SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::GetHash() const {
+    // Длина входит в хеш, чтобы хеш не зависел только от значений с нулевым вкладом
+    std::uint64_t hash = GetFingerprintHash() ^ (static_cast<std::uint64_t>(size_) * 0xFF51AFD7ED558CCDull);
+    hash = (hash ^ (hash >> 33)) * 0xC4CEB9FE1A85EC53ull;
+    return static_cast<size_t>(hash ^ (hash >> 33));
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+bool SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::IsEqualTo(const SingleLinkedList& other) const {
+    // Списки разной длины не равны, и обходить их не нужно
+    if (size_ != other.size_) {
+        return false;
+    }
+    if constexpr (MAINTAINS_FINGERPRINT) {
+        if (fingerprint_.is_valid && other.fingerprint_.is_valid && fingerprint_.hash != other.fingerprint_.hash) {
+            return false;
+        }
+    }
+    if constexpr (COLLECTS_STATISTICS) {
+        // Списки обходятся до первого различия, пройденные элементы учитываются в статистике обоих
+        size_t steps = 0;
+        bool is_equal = true;
+        for (const Node *lhs = head_.next_node, *rhs = other.head_.next_node; lhs != nullptr;
+             lhs = lhs->next_node, rhs = rhs->next_node) {
+            ++steps;
+            if (!(lhs->value == rhs->value)) {
+                is_equal = false;
+                break;
+            }
+        }
+        CountTraversal(steps);
+        other.CountTraversal(steps);
+        return is_equal;
+    } else {
+        return std::equal(begin(), end(), other.begin());
+    }
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+typename SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::allocator_type SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::get_allocator() const noexcept {
+    return allocator_type(node_alloc_);
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+ListStatisticsSnapshot SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::GetStatistics() const noexcept {
+    static_assert(COLLECTS_STATISTICS, "GetStatistics requires CollectListStatistics policy");
+    return statistics_.GetSnapshot();
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+void SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::SetStatisticsLabel(const char* label) noexcept {
+    static_assert(COLLECTS_STATISTICS, "SetStatisticsLabel requires CollectListStatistics policy");
+    statistics_.SetLabel(label);
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+typename SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::CountedView SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::Counted() noexcept {
+    static_assert(COLLECTS_STATISTICS, "Counted requires CollectListStatistics policy");
+    return CountedView{head_.next_node, &statistics_};
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+typename SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::ConstCountedView SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>::Counted() const noexcept {
+    static_assert(COLLECTS_STATISTICS, "Counted requires CollectListStatistics policy");
+    return ConstCountedView{head_.next_node, &statistics_};
+}
+
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+void swap(SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>& lhs, SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+bool operator==(const SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>& lhs, const SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>& rhs) {
+    return lhs.IsEqualTo(rhs);
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+bool operator!=(const SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>& lhs, const SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>& rhs) {
+    return !(lhs == rhs);
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+bool operator<(const SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>& lhs, const SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>& rhs) {
+    return lhs.CompareTo(rhs) < 0;
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+bool operator>(const SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>& lhs, const SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>& rhs) {
+    return lhs.CompareTo(rhs) > 0;
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+bool operator<=(const SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>& lhs, const SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>& rhs) {
+    return lhs.CompareTo(rhs) <= 0;
+}
+
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+bool operator>=(const SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>& lhs, const SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>& rhs) {
+    return lhs.CompareTo(rhs) >= 0;
+}
+
+#if __cplusplus > 201703L
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+std::weak_ordering operator<=>(const SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>& lhs, const SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>& rhs) {
+    const int result = lhs.CompareTo(rhs);
+    if (result < 0) {
+        return std::weak_ordering::less;
+    }
+    return result == 0 ? std::weak_ordering::equivalent : std::weak_ordering::greater;
+}
+#endif
+
+#if __cplusplus > 201703L
+// Замыкание конвейера, которое собирает диапазон в список типа List: range | ToList<List>()
+template <typename List>
+struct ToListClosure {};
+
+// Замыкание конвейера, выводящее тип элементов списка из диапазона: range | ToList<SingleLinkedList>()
+template <template <typename...> class ListTemplate>
+struct DeducedToListClosure {};
+
+/*
+ * Аналог std::ranges::to из C++23 для списков. Собирает ленивое представление в список
+ * за один проход через ListType::FromRange, без промежуточных контейнеров:
+ *     auto evens = list | std::views::filter(is_even) | ToList<SingleLinkedList>();
+ */
+template <typename List>
+[[nodiscard]] constexpr ToListClosure<List> ToList() noexcept {
+    return {};
+}
+
+template <template <typename...> class ListTemplate>
+[[nodiscard]] constexpr DeducedToListClosure<ListTemplate> ToList() noexcept {
+    return {};
+}
+
+template <std::ranges::input_range Range, typename List>
+[[nodiscard]] List operator|(Range&& range, ToListClosure<List>) {
+    return List::FromRange(std::forward<Range>(range));
+}
+
+template <std::ranges::input_range Range, template <typename...> class ListTemplate>
+[[nodiscard]] auto operator|(Range&& range, DeducedToListClosure<ListTemplate>) {
+    return ListTemplate<std::ranges::range_value_t<Range>>::FromRange(std::forward<Range>(range));
+}
+#endif
+
+namespace std {
+
+// Хеш списка для unordered-контейнеров. При политике IncrementalFingerprint вычисляется за время O(1)
+template <typename Type, typename Allocator, typename TailPolicy, typename StatsPolicy, typename ReservePolicy, typename FingerprintPolicy, typename IndexPolicy>
+struct hash<SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>> {
+    size_t operator()(const SingleLinkedList<Type, Allocator, TailPolicy, StatsPolicy, ReservePolicy, FingerprintPolicy, IndexPolicy>& list) const {
+        return list.GetHash();
+    }
+};
 
-template <typename Type>
-bool operator>=(const SingleLinkedList<Type>& lhs, const SingleLinkedList<Type>& rhs) {
-    return (lhs > rhs) || (lhs == rhs);
-} 
\ No newline at end of file
+}  // namespace std
@@ -0,0 +1,572 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/*
+ * Односвязный список со встроенной памятью на N узлов: первые N узлов размещаются
+ * внутри самого объекта списка рядом с head_, и только следующие выделяются в куче.
+ * Освобождённые встроенные ячейки используются повторно, поэтому список,
+ * в котором одновременно не больше N элементов, вообще не обращается к аллокатору.
+ * Интерфейс повторяет SingleLinkedList.
+ *
+ * Встроенные узлы нельзя передать другому списку, поэтому перемещение и обмен
+ * перемещают их значения по одному. Узлы в куче передаются вместе с остатком
+ * цепочки, как только перемещены все встроенные узлы. Время перемещения
+ * пропорционально длине начала списка, содержащего все встроенные узлы:
+ * O(N), если встроенные узлы стоят в начале, и O(GetSize()) в худшем случае.
+ * Итераторы и ссылки на элементы перемещённого списка становятся недействительными
+ */
+template <typename Type, size_t N = 4>
+class SmallSingleLinkedList {
+    static_assert(N > 0, "Use SingleLinkedList for lists without inline storage");
+
+    struct Node;
+
+    // Фиктивный узел, используется для вставки "перед первым элементом"
+    struct NodeBase {
+        Node* next_node = nullptr;
+    };
+
+    struct Node : NodeBase {
+        template <typename... Args>
+        Node(std::in_place_t, Node* next, Args&&... args)
+            : NodeBase{next}
+            , value(std::forward<Args>(args)...) {
+        }
+        Type value;
+    };
+
+    // Встроенная ячейка хранит узел, а пока свободна - указатель на следующую свободную ячейку
+    union Slot {
+        Slot* next_free;
+        alignas(Node) unsigned char storage[sizeof(Node)];
+    };
+
+    using NodeAllocator = std::allocator<Node>;
+
+    // Шаблон класса «Базовый Итератор».
+    // ValueType — совпадает с Type (для Iterator) либо с const Type (для ConstIterator)
+    template <typename ValueType>
+    class BasicIterator {
+        friend class SmallSingleLinkedList;
+
+        explicit BasicIterator(NodeBase* node) noexcept
+            : node_(node) {
+        }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = ValueType*;
+        using reference = ValueType&;
+
+        BasicIterator() = default;
+
+        // Конвертирующий конструктор/конструктор копирования
+        BasicIterator(const BasicIterator<Type>& other) noexcept
+            : node_(other.node_) {
+        }
+
+        BasicIterator& operator=(const BasicIterator& rhs) = default;
+
+        [[nodiscard]] bool operator==(const BasicIterator<const Type>& rhs) const noexcept {
+            return node_ == rhs.node_;
+        }
+
+        [[nodiscard]] bool operator!=(const BasicIterator<const Type>& rhs) const noexcept {
+            return !(node_ == rhs.node_);
+        }
+
+        [[nodiscard]] bool operator==(const BasicIterator<Type>& rhs) const noexcept {
+            return node_ == rhs.node_;
+        }
+
+        [[nodiscard]] bool operator!=(const BasicIterator<Type>& rhs) const noexcept {
+            return !(node_ == rhs.node_);
+        }
+
+        // Инкремент итератора, не указывающего на существующий элемент списка, приводит к неопределённому поведению
+        BasicIterator& operator++() noexcept {
+            assert(node_ != nullptr);
+            node_ = node_->next_node;
+            return *this;
+        }
+
+        BasicIterator operator++(int) noexcept {
+            auto old_it(*this);
+            ++(*this);
+            return old_it;
+        }
+
+        [[nodiscard]] reference operator*() const noexcept {
+            assert(node_ != nullptr);
+            return static_cast<Node*>(node_)->value;
+        }
+
+        [[nodiscard]] pointer operator->() const noexcept {
+            assert(node_ != nullptr);
+            return &static_cast<Node*>(node_)->value;
+        }
+
+    private:
+        NodeBase* node_ = nullptr;
+    };
+
+public:
+    using value_type = Type;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+
+    using Iterator = BasicIterator<Type>;
+    using ConstIterator = BasicIterator<const Type>;
+
+    // Количество узлов, размещаемых внутри объекта списка
+    static constexpr size_t INLINE_CAPACITY = N;
+
+    [[nodiscard]] Iterator begin() noexcept {
+        return Iterator{head_.next_node};
+    }
+
+    [[nodiscard]] Iterator end() noexcept {
+        return Iterator{};
+    }
+
+    [[nodiscard]] ConstIterator begin() const noexcept {
+        return cbegin();
+    }
+
+    [[nodiscard]] ConstIterator end() const noexcept {
+        return cend();
+    }
+
+    [[nodiscard]] ConstIterator cbegin() const noexcept {
+        return ConstIterator{head_.next_node};
+    }
+
+    [[nodiscard]] ConstIterator cend() const noexcept {
+        return ConstIterator{};
+    }
+
+    // Возвращает итератор, указывающий на позицию перед первым элементом списка.
+    // Разыменовывать этот итератор нельзя - попытка разыменования приведёт к неопределённому поведению
+    [[nodiscard]] Iterator before_begin() noexcept {
+        return Iterator{&head_};
+    }
+
+    [[nodiscard]] ConstIterator cbefore_begin() const noexcept {
+        return ConstIterator{const_cast<NodeBase*>(&head_)};
+    }
+
+    [[nodiscard]] ConstIterator before_begin() const noexcept {
+        return cbefore_begin();
+    }
+
+    SmallSingleLinkedList() noexcept {
+    }
+
+    SmallSingleLinkedList(std::initializer_list<Type> values);
+
+    template <typename It, typename = std::enable_if_t<std::is_convertible_v<
+                               typename std::iterator_traits<It>::iterator_category, std::input_iterator_tag>>>
+    SmallSingleLinkedList(It first, It last);
+
+    SmallSingleLinkedList(const SmallSingleLinkedList& other);
+
+    // Перемещает встроенные узлы по одному, узлы в куче передаются без копирования.
+    // Если перемещение элемента выбросит исключение, оставшиеся элементы останутся в other
+    SmallSingleLinkedList(SmallSingleLinkedList&& other) noexcept(std::is_nothrow_move_constructible_v<Type>);
+
+    SmallSingleLinkedList& operator=(const SmallSingleLinkedList& rhs);
+
+    SmallSingleLinkedList& operator=(SmallSingleLinkedList&& rhs) noexcept(std::is_nothrow_move_constructible_v<Type>);
+
+    ~SmallSingleLinkedList();
+
+    // Обменивает содержимое списков тремя перемещениями
+    void swap(SmallSingleLinkedList& other) noexcept(std::is_nothrow_move_constructible_v<Type>);
+
+    /*
+     * Вставляет элемент value после элемента, на который указывает pos, за время O(1).
+     * Пока есть свободная встроенная ячейка, память не выделяется.
+     * Возвращает итератор на вставленный элемент
+     * Если при создании элемента будет выброшено исключение, список останется в прежнем состоянии
+     */
+    Iterator InsertAfter(ConstIterator pos, const Type& value);
+
+    Iterator InsertAfter(ConstIterator pos, Type&& value);
+
+    template <typename... Args>
+    Iterator EmplaceAfter(ConstIterator pos, Args&&... args);
+
+    /*
+     * Удаляет элемент, следующий за pos, за время O(1). Встроенная ячейка становится свободной.
+     * Возвращает итератор на элемент, следующий за удалённым
+     */
+    Iterator EraseAfter(ConstIterator pos) noexcept;
+
+    void PushFront(const Type& value);
+
+    void PushFront(Type&& value);
+
+    template <typename... Args>
+    Type& EmplaceFront(Args&&... args);
+
+    void PopFront() noexcept;
+
+    [[nodiscard]] Type& Front() noexcept;
+    [[nodiscard]] const Type& Front() const noexcept;
+
+    // Очищает список за время O(N)
+    void Clear() noexcept;
+
+    [[nodiscard]] size_t GetSize() const noexcept;
+
+    [[nodiscard]] bool IsEmpty() const noexcept;
+
+    // Количество элементов, размещённых во встроенных ячейках
+    [[nodiscard]] size_t GetInlineSize() const noexcept;
+
+private:
+    template <typename... Args>
+    Node* CreateNode(Node* next, Args&&... args);
+
+    void DestroyNode(Node* node) noexcept;
+
+    // Возвращает память под узел: свободную встроенную ячейку либо блок из кучи
+    void* AllocateNode();
+
+    void DeallocateNode(void* memory) noexcept;
+
+    [[nodiscard]] bool IsInline(const void* memory) const noexcept;
+
+    // Забирает все узлы other в пустой список
+    void StealNodes(SmallSingleLinkedList& other) noexcept(std::is_nothrow_move_constructible_v<Type>);
+
+    template <typename It>
+    void MakeList(It first, It last);
+
+    NodeBase head_;
+    size_t size_ = 0;
+    // Количество занятых встроенных ячеек
+    size_t inline_size_ = 0;
+    // Ячейки с индексами не меньше inline_used_ ни разу не использовались
+    size_t inline_used_ = 0;
+    Slot* free_slots_ = nullptr;
+    Slot slots_[N];
+};
+
+template <typename Type, size_t N>
+SmallSingleLinkedList<Type, N>::SmallSingleLinkedList(std::initializer_list<Type> values) {
+    MakeList(values.begin(), values.end());
+}
+
+template <typename Type, size_t N>
+template <typename It, typename>
+SmallSingleLinkedList<Type, N>::SmallSingleLinkedList(It first, It last) {
+    MakeList(first, last);
+}
+
+template <typename Type, size_t N>
+SmallSingleLinkedList<Type, N>::SmallSingleLinkedList(const SmallSingleLinkedList& other) {
+    MakeList(other.begin(), other.end());
+}
+
+template <typename Type, size_t N>
+SmallSingleLinkedList<Type, N>::SmallSingleLinkedList(SmallSingleLinkedList&& other) noexcept(
+    std::is_nothrow_move_constructible_v<Type>) {
+    StealNodes(other);
+}
+
+template <typename Type, size_t N>
+SmallSingleLinkedList<Type, N>& SmallSingleLinkedList<Type, N>::operator=(const SmallSingleLinkedList& rhs) {
+    if (this == &rhs) {
+        return *this;
+    }
+    if constexpr (std::is_nothrow_move_constructible_v<Type>) {
+        SmallSingleLinkedList copy(rhs);
+        Clear();
+        StealNodes(copy);
+    } else {
+        // Перемещение элементов может выбросить исключение, поэтому копия строится в свободных
+        // встроенных ячейках и в куче рядом со старыми узлами, которые разрушаются, только когда копия готова
+        NodeBase copy;
+        NodeBase* tail = &copy;
+        try {
+            for (const Type& value : rhs) {
+                tail = tail->next_node = CreateNode(nullptr, value);
+            }
+        } catch (...) {
+            while (copy.next_node != nullptr) {
+                DestroyNode(std::exchange(copy.next_node, copy.next_node->next_node));
+            }
+            throw;
+        }
+        while (head_.next_node != nullptr) {
+            DestroyNode(std::exchange(head_.next_node, head_.next_node->next_node));
+        }
+        head_.next_node = copy.next_node;
+        size_ = rhs.size_;
+    }
+    return *this;
+}
+
+template <typename Type, size_t N>
+SmallSingleLinkedList<Type, N>& SmallSingleLinkedList<Type, N>::operator=(SmallSingleLinkedList&& rhs) noexcept(
+    std::is_nothrow_move_constructible_v<Type>) {
+    if (this != &rhs) {
+        Clear();
+        StealNodes(rhs);
+    }
+    return *this;
+}
+
+template <typename Type, size_t N>
+SmallSingleLinkedList<Type, N>::~SmallSingleLinkedList() {
+    Clear();
+}
+
+template <typename Type, size_t N>
+void SmallSingleLinkedList<Type, N>::swap(SmallSingleLinkedList& other) noexcept(
+    std::is_nothrow_move_constructible_v<Type>) {
+    if (this != &other) {
+        SmallSingleLinkedList temp(std::move(other));
+        other = std::move(*this);
+        *this = std::move(temp);
+    }
+}
+
+template <typename Type, size_t N>
+typename SmallSingleLinkedList<Type, N>::Iterator SmallSingleLinkedList<Type, N>::InsertAfter(
+    ConstIterator pos, const Type& value) {
+    return EmplaceAfter(pos, value);
+}
+
+template <typename Type, size_t N>
+typename SmallSingleLinkedList<Type, N>::Iterator SmallSingleLinkedList<Type, N>::InsertAfter(
+    ConstIterator pos, Type&& value) {
+    return EmplaceAfter(pos, std::move(value));
+}
+
+template <typename Type, size_t N>
+template <typename... Args>
+typename SmallSingleLinkedList<Type, N>::Iterator SmallSingleLinkedList<Type, N>::EmplaceAfter(
+    ConstIterator pos, Args&&... args) {
+    assert(pos.node_ != nullptr);
+    Node* node = CreateNode(pos.node_->next_node, std::forward<Args>(args)...);
+    pos.node_->next_node = node;
+    ++size_;
+    return Iterator{node};
+}
+
+template <typename Type, size_t N>
+typename SmallSingleLinkedList<Type, N>::Iterator SmallSingleLinkedList<Type, N>::EraseAfter(
+    ConstIterator pos) noexcept {
+    assert(pos.node_ != nullptr && pos.node_->next_node != nullptr);
+    Node* erased = pos.node_->next_node;
+    pos.node_->next_node = erased->next_node;
+    DestroyNode(erased);
+    --size_;
+    return Iterator{pos.node_->next_node};
+}
+
+template <typename Type, size_t N>
+void SmallSingleLinkedList<Type, N>::PushFront(const Type& value) {
+    EmplaceFront(value);
+}
+
+template <typename Type, size_t N>
+void SmallSingleLinkedList<Type, N>::PushFront(Type&& value) {
+    EmplaceFront(std::move(value));
+}
+
+template <typename Type, size_t N>
+template <typename... Args>
+Type& SmallSingleLinkedList<Type, N>::EmplaceFront(Args&&... args) {
+    return *EmplaceAfter(cbefore_begin(), std::forward<Args>(args)...);
+}
+
+template <typename Type, size_t N>
+void SmallSingleLinkedList<Type, N>::PopFront() noexcept {
+    assert(size_ > 0);
+    EraseAfter(cbefore_begin());
+}
+
+template <typename Type, size_t N>
+Type& SmallSingleLinkedList<Type, N>::Front() noexcept {
+    assert(size_ > 0);
+    return head_.next_node->value;
+}
+
+template <typename Type, size_t N>
+const Type& SmallSingleLinkedList<Type, N>::Front() const noexcept {
+    assert(size_ > 0);
+    return head_.next_node->value;
+}
+
+template <typename Type, size_t N>
+void SmallSingleLinkedList<Type, N>::Clear() noexcept {
+    while (head_.next_node != nullptr) {
+        DestroyNode(std::exchange(head_.next_node, head_.next_node->next_node));
+    }
+    size_ = 0;
+    // Все встроенные ячейки свободны, их список можно начать заново
+    inline_size_ = 0;
+    inline_used_ = 0;
+    free_slots_ = nullptr;
+}
+
+template <typename Type, size_t N>
+size_t SmallSingleLinkedList<Type, N>::GetSize() const noexcept {
+    return size_;
+}
+
+template <typename Type, size_t N>
+bool SmallSingleLinkedList<Type, N>::IsEmpty() const noexcept {
+    return size_ == 0;
+}
+
+template <typename Type, size_t N>
+size_t SmallSingleLinkedList<Type, N>::GetInlineSize() const noexcept {
+    return inline_size_;
+}
+
+template <typename Type, size_t N>
+template <typename... Args>
+typename SmallSingleLinkedList<Type, N>::Node* SmallSingleLinkedList<Type, N>::CreateNode(Node* next, Args&&... args) {
+    void* memory = AllocateNode();
+    try {
+        return ::new (memory) Node(std::in_place, next, std::forward<Args>(args)...);
+    } catch (...) {
+        DeallocateNode(memory);
+        throw;
+    }
+}
+
+template <typename Type, size_t N>
+void SmallSingleLinkedList<Type, N>::DestroyNode(Node* node) noexcept {
+    node->~Node();
+    DeallocateNode(node);
+}
+
+template <typename Type, size_t N>
+void* SmallSingleLinkedList<Type, N>::AllocateNode() {
+    if (free_slots_ != nullptr) {
+        ++inline_size_;
+        return std::exchange(free_slots_, free_slots_->next_free)->storage;
+    }
+    if (inline_used_ < N) {
+        ++inline_size_;
+        return slots_[inline_used_++].storage;
+    }
+    NodeAllocator allocator;
+    return std::allocator_traits<NodeAllocator>::allocate(allocator, 1);
+}
+
+template <typename Type, size_t N>
+void SmallSingleLinkedList<Type, N>::DeallocateNode(void* memory) noexcept {
+    if (IsInline(memory)) {
+        // Массив storage - начало ячейки, поэтому адрес памяти узла совпадает с адресом ячейки
+        Slot* slot = ::new (memory) Slot;
+        slot->next_free = std::exchange(free_slots_, slot);
+        --inline_size_;
+    } else {
+        NodeAllocator allocator;
+        std::allocator_traits<NodeAllocator>::deallocate(allocator, static_cast<Node*>(memory), 1);
+    }
+}
+
+template <typename Type, size_t N>
+bool SmallSingleLinkedList<Type, N>::IsInline(const void* memory) const noexcept {
+    // std::less сравнивает и указатели, не принадлежащие одному массиву
+    const std::less<const void*> less;
+    return !less(memory, slots_) && less(memory, slots_ + N);
+}
+
+template <typename Type, size_t N>
+void SmallSingleLinkedList<Type, N>::StealNodes(SmallSingleLinkedList& other) noexcept(
+    std::is_nothrow_move_constructible_v<Type>) {
+    assert(size_ == 0 && this != &other);
+    NodeBase* tail = &head_;
+    // Встроенных ячеек хватает: в other не больше N встроенных узлов, а текущий список пуст
+    while (other.inline_size_ > 0) {
+        Node* node = other.head_.next_node;
+        if (other.IsInline(node)) {
+            Node* moved = CreateNode(nullptr, std::move(node->value));
+            other.head_.next_node = node->next_node;
+            other.DestroyNode(node);
+            node = moved;
+        } else {
+            other.head_.next_node = node->next_node;
+        }
+        node->next_node = nullptr;
+        tail->next_node = node;
+        tail = node;
+        ++size_;
+        --other.size_;
+    }
+    // В other остались только узлы в куче, они передаются одной записью указателя
+    tail->next_node = std::exchange(other.head_.next_node, nullptr);
+    size_ += std::exchange(other.size_, 0);
+    other.inline_used_ = 0;
+    other.free_slots_ = nullptr;
+}
+
+template <typename Type, size_t N>
+template <typename It>
+void SmallSingleLinkedList<Type, N>::MakeList(It first, It last) {
+    NodeBase* tail = &head_;
+    try {
+        for (; first != last; ++first) {
+            tail = EmplaceAfter(ConstIterator{tail}, *first).node_;
+        }
+    } catch (...) {
+        Clear();
+        throw;
+    }
+}
+
+template <typename Type, size_t N>
+void swap(SmallSingleLinkedList<Type, N>& lhs, SmallSingleLinkedList<Type, N>& rhs) noexcept(
+    std::is_nothrow_move_constructible_v<Type>) {
+    lhs.swap(rhs);
+}
+
+template <typename Type, size_t N>
+bool operator==(const SmallSingleLinkedList<Type, N>& lhs, const SmallSingleLinkedList<Type, N>& rhs) {
+    return lhs.GetSize() == rhs.GetSize() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <typename Type, size_t N>
+bool operator!=(const SmallSingleLinkedList<Type, N>& lhs, const SmallSingleLinkedList<Type, N>& rhs) {
+    return !(lhs == rhs);
+}
+
+template <typename Type, size_t N>
+bool operator<(const SmallSingleLinkedList<Type, N>& lhs, const SmallSingleLinkedList<Type, N>& rhs) {
+    return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename Type, size_t N>
+bool operator>(const SmallSingleLinkedList<Type, N>& lhs, const SmallSingleLinkedList<Type, N>& rhs) {
+    return rhs < lhs;
+}
+
+template <typename Type, size_t N>
+bool operator<=(const SmallSingleLinkedList<Type, N>& lhs, const SmallSingleLinkedList<Type, N>& rhs) {
+    return !(rhs < lhs);
+}
+
+template <typename Type, size_t N>
+bool operator>=(const SmallSingleLinkedList<Type, N>& lhs, const SmallSingleLinkedList<Type, N>& rhs) {
+    return !(lhs < rhs);
+}
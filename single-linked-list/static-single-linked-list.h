@@ -0,0 +1,463 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+/*
+ * Односвязный список фиксированной ёмкости N, все узлы которого хранятся внутри объекта списка.
+ * Связи между узлами - индексы наименьшего беззнакового типа, вмещающего N + 1.
+ * Все операции - constexpr, поэтому список можно построить во время компиляции
+ * и сохранить в constexpr-переменной, которая попадёт в данные только для чтения:
+ *
+ *     constexpr StaticSingleLinkedList<int, 4> TABLE{1, 2, 3};
+ *
+ * Type должен иметь конструктор по умолчанию и оператор присваивания перемещением: ячейки
+ * без элементов хранят значения Type{}. Список - литеральный тип, если Type тривиально разрушаем.
+ * Вставка в заполненный список выбрасывает std::length_error, во время компиляции это ошибка компиляции
+ */
+template <typename Type, size_t N>
+class StaticSingleLinkedList {
+    static_assert(N > 0, "N must be positive");
+    static_assert(std::is_default_constructible_v<Type>, "Type must be default constructible");
+
+    using Index = std::conditional_t<N < std::numeric_limits<std::uint8_t>::max(), std::uint8_t,
+                  std::conditional_t<N < std::numeric_limits<std::uint16_t>::max(), std::uint16_t,
+                  std::conditional_t<N < std::numeric_limits<std::uint32_t>::max(), std::uint32_t, size_t>>>;
+
+    // Индекс фиктивного узла, используется для вставки "перед первым элементом"
+    static constexpr Index HEAD = N;
+    // Индекс, обозначающий отсутствие следующего узла
+    static constexpr Index NIL = N + 1;
+
+    // Шаблон класса «Базовый Итератор».
+    // Итератор хранит адрес списка и индекс ячейки
+    // ValueType — совпадает с Type (для Iterator) либо с const Type (для ConstIterator)
+    template <typename ValueType>
+    class BasicIterator {
+        friend class StaticSingleLinkedList;
+
+        using List = std::conditional_t<std::is_const_v<ValueType>, const StaticSingleLinkedList, StaticSingleLinkedList>;
+
+        constexpr BasicIterator(List* list, Index index) noexcept
+            : list_(list)
+            , index_(index) {
+        }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = ValueType*;
+        using reference = ValueType&;
+
+        BasicIterator() = default;
+
+        // Конвертирующий конструктор/конструктор копирования
+        constexpr BasicIterator(const BasicIterator<Type>& other) noexcept
+            : list_(other.list_)
+            , index_(other.index_) {
+        }
+
+        BasicIterator& operator=(const BasicIterator& rhs) = default;
+
+        [[nodiscard]] constexpr bool operator==(const BasicIterator<const Type>& rhs) const noexcept {
+            return index_ == rhs.index_;
+        }
+
+        [[nodiscard]] constexpr bool operator!=(const BasicIterator<const Type>& rhs) const noexcept {
+            return !(index_ == rhs.index_);
+        }
+
+        [[nodiscard]] constexpr bool operator==(const BasicIterator<Type>& rhs) const noexcept {
+            return index_ == rhs.index_;
+        }
+
+        [[nodiscard]] constexpr bool operator!=(const BasicIterator<Type>& rhs) const noexcept {
+            return !(index_ == rhs.index_);
+        }
+
+        // Инкремент итератора, не указывающего на существующий элемент списка, приводит к неопределённому поведению
+        constexpr BasicIterator& operator++() noexcept {
+            assert(index_ != NIL);
+            index_ = list_->next_[index_];
+            return *this;
+        }
+
+        constexpr BasicIterator operator++(int) noexcept {
+            auto old_it(*this);
+            ++(*this);
+            return old_it;
+        }
+
+        [[nodiscard]] constexpr reference operator*() const noexcept {
+            assert(index_ != NIL && index_ != HEAD);
+            return list_->values_[index_];
+        }
+
+        [[nodiscard]] constexpr pointer operator->() const noexcept {
+            assert(index_ != NIL && index_ != HEAD);
+            return &list_->values_[index_];
+        }
+
+    private:
+        List* list_ = nullptr;
+        Index index_ = NIL;
+    };
+
+public:
+    using value_type = Type;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+
+    using Iterator = BasicIterator<Type>;
+    using ConstIterator = BasicIterator<const Type>;
+
+    // Наибольшее количество элементов списка
+    static constexpr size_t CAPACITY = N;
+
+    [[nodiscard]] constexpr Iterator begin() noexcept {
+        return Iterator{this, next_[HEAD]};
+    }
+
+    [[nodiscard]] constexpr Iterator end() noexcept {
+        return Iterator{this, NIL};
+    }
+
+    [[nodiscard]] constexpr ConstIterator begin() const noexcept {
+        return ConstIterator{this, next_[HEAD]};
+    }
+
+    [[nodiscard]] constexpr ConstIterator end() const noexcept {
+        return ConstIterator{this, NIL};
+    }
+
+    [[nodiscard]] constexpr ConstIterator cbegin() const noexcept {
+        return begin();
+    }
+
+    [[nodiscard]] constexpr ConstIterator cend() const noexcept {
+        return end();
+    }
+
+    // Возвращает итератор, указывающий на позицию перед первым элементом односвязного списка.
+    // Разыменовывать этот итератор нельзя - попытка разыменования приведёт к неопределённому поведению
+    [[nodiscard]] constexpr Iterator before_begin() noexcept {
+        return Iterator{this, HEAD};
+    }
+
+    [[nodiscard]] constexpr ConstIterator cbefore_begin() const noexcept {
+        return ConstIterator{this, HEAD};
+    }
+
+    [[nodiscard]] constexpr ConstIterator before_begin() const noexcept {
+        return cbefore_begin();
+    }
+
+    constexpr StaticSingleLinkedList() noexcept(std::is_nothrow_default_constructible_v<Type>);
+
+    constexpr StaticSingleLinkedList(std::initializer_list<Type> values);
+
+    template <typename It, typename = std::enable_if_t<std::is_convertible_v<
+        typename std::iterator_traits<It>::iterator_category, std::input_iterator_tag>>>
+    constexpr StaticSingleLinkedList(It first, It last);
+
+    // Копирование и перемещение переносят все N ячеек поэлементно
+    constexpr StaticSingleLinkedList(const StaticSingleLinkedList& other) = default;
+    constexpr StaticSingleLinkedList(StaticSingleLinkedList&& other) = default;
+    constexpr StaticSingleLinkedList& operator=(const StaticSingleLinkedList& rhs) = default;
+    constexpr StaticSingleLinkedList& operator=(StaticSingleLinkedList&& rhs) = default;
+
+    // Обменивает содержимое списков за время O(N)
+    constexpr void swap(StaticSingleLinkedList& other) noexcept(std::is_nothrow_move_constructible_v<Type> && std::is_nothrow_move_assignable_v<Type>);
+
+    /*
+     * Вставляет элемент value после элемента, на который указывает pos.
+     * Возвращает итератор на вставленный элемент
+     * Если список заполнен, выбрасывает std::length_error.
+     * Если при создании элемента будет выброшено исключение, список останется в прежнем состоянии
+     */
+    constexpr Iterator InsertAfter(ConstIterator pos, const Type& value);
+
+    constexpr Iterator InsertAfter(ConstIterator pos, Type&& value);
+
+    // Конструирует элемент из аргументов args и вставляет его после pos. Гарантии те же, что у InsertAfter
+    template <typename... Args>
+    constexpr Iterator EmplaceAfter(ConstIterator pos, Args&&... args);
+
+    /*
+     * Удаляет элемент, следующий за pos. Ячейка удалённого элемента получает значение Type{}.
+     * Возвращает итератор на элемент, следующий за удалённым
+     */
+    constexpr Iterator EraseAfter(ConstIterator pos) noexcept(std::is_nothrow_move_assignable_v<Type>);
+
+    constexpr void PushFront(const Type& value);
+
+    constexpr void PushFront(Type&& value);
+
+    template <typename... Args>
+    constexpr Type& EmplaceFront(Args&&... args);
+
+    constexpr void PopFront() noexcept(std::is_nothrow_move_assignable_v<Type>);
+
+    // Возвращает ссылку на первый элемент непустого списка
+    [[nodiscard]] constexpr Type& Front() noexcept;
+    [[nodiscard]] constexpr const Type& Front() const noexcept;
+
+    // Очищает список за время O(N)
+    constexpr void Clear() noexcept(std::is_nothrow_move_assignable_v<Type>);
+
+    [[nodiscard]] constexpr size_t GetSize() const noexcept;
+
+    [[nodiscard]] constexpr bool IsEmpty() const noexcept;
+
+    // Сообщает, заполнен ли список до ёмкости N
+    [[nodiscard]] constexpr bool IsFull() const noexcept;
+
+    /*
+     * Лексикографически сравнивает список с other за один проход.
+     * Возвращает отрицательное число, если список меньше other, ноль, если списки равны,
+     * и положительное число, если список больше. Элементы сравниваются только оператором <
+     */
+    [[nodiscard]] constexpr int CompareTo(const StaticSingleLinkedList& other) const;
+
+private:
+    // Возвращает свободную ячейку либо выбрасывает std::length_error, если свободных ячеек нет
+    constexpr Index AcquireSlot();
+
+    // Присоединяет ячейку slot к списку после ячейки prev
+    constexpr void LinkSlot(Index prev, Index slot) noexcept;
+
+    Type values_[N] = {};
+    // next_[HEAD] - первый элемент списка. В свободных ячейках next_ связывает список свободных ячеек
+    Index next_[N + 1] = {};
+    // Ячейки с индексами не меньше used_ ни разу не использовались
+    Index used_ = 0;
+    Index free_ = NIL;
+    Index size_ = 0;
+};
+
+template <typename Type, size_t N>
+constexpr StaticSingleLinkedList<Type, N>::StaticSingleLinkedList() noexcept(std::is_nothrow_default_constructible_v<Type>) {
+    next_[HEAD] = NIL;
+}
+
+template <typename Type, size_t N>
+constexpr StaticSingleLinkedList<Type, N>::StaticSingleLinkedList(std::initializer_list<Type> values)
+    : StaticSingleLinkedList(values.begin(), values.end()) {
+}
+
+template <typename Type, size_t N>
+template <typename It, typename>
+constexpr StaticSingleLinkedList<Type, N>::StaticSingleLinkedList(It first, It last)
+    : StaticSingleLinkedList() {
+    Index tail = HEAD;
+    for (; first != last; ++first) {
+        tail = InsertAfter(ConstIterator{this, tail}, *first).index_;
+    }
+}
+
+template <typename Type, size_t N>
+constexpr void StaticSingleLinkedList<Type, N>::swap(StaticSingleLinkedList& other) noexcept(std::is_nothrow_move_constructible_v<Type> && std::is_nothrow_move_assignable_v<Type>) {
+    // std::swap становится constexpr только в C++20
+    const auto exchange = [](auto& lhs, auto& rhs) {
+        auto tmp = std::move(lhs);
+        lhs = std::move(rhs);
+        rhs = std::move(tmp);
+    };
+    for (size_t i = 0; i < N; ++i) {
+        exchange(values_[i], other.values_[i]);
+    }
+    for (size_t i = 0; i <= N; ++i) {
+        exchange(next_[i], other.next_[i]);
+    }
+    exchange(used_, other.used_);
+    exchange(free_, other.free_);
+    exchange(size_, other.size_);
+}
+
+template <typename Type, size_t N>
+constexpr typename StaticSingleLinkedList<Type, N>::Iterator StaticSingleLinkedList<Type, N>::InsertAfter(
+    ConstIterator pos, const Type& value) {
+    return EmplaceAfter(pos, value);
+}
+
+template <typename Type, size_t N>
+constexpr typename StaticSingleLinkedList<Type, N>::Iterator StaticSingleLinkedList<Type, N>::InsertAfter(
+    ConstIterator pos, Type&& value) {
+    return EmplaceAfter(pos, std::move(value));
+}
+
+template <typename Type, size_t N>
+template <typename... Args>
+constexpr typename StaticSingleLinkedList<Type, N>::Iterator StaticSingleLinkedList<Type, N>::EmplaceAfter(
+    ConstIterator pos, Args&&... args) {
+    assert(pos.index_ != NIL);
+    if (IsFull()) {
+        throw std::length_error("StaticSingleLinkedList capacity exceeded");
+    }
+    // Значение создаётся до того, как список изменится
+    Type value(std::forward<Args>(args)...);
+    const Index slot = AcquireSlot();
+    values_[slot] = std::move(value);
+    LinkSlot(pos.index_, slot);
+    return Iterator{this, slot};
+}
+
+template <typename Type, size_t N>
+constexpr typename StaticSingleLinkedList<Type, N>::Iterator StaticSingleLinkedList<Type, N>::EraseAfter(
+    ConstIterator pos) noexcept(std::is_nothrow_move_assignable_v<Type>) {
+    assert(pos.index_ != NIL && next_[pos.index_] != NIL);
+    const Index erased = next_[pos.index_];
+    next_[pos.index_] = next_[erased];
+    values_[erased] = Type();
+    next_[erased] = free_;
+    free_ = erased;
+    --size_;
+    return Iterator{this, next_[pos.index_]};
+}
+
+template <typename Type, size_t N>
+constexpr void StaticSingleLinkedList<Type, N>::PushFront(const Type& value) {
+    EmplaceAfter(cbefore_begin(), value);
+}
+
+template <typename Type, size_t N>
+constexpr void StaticSingleLinkedList<Type, N>::PushFront(Type&& value) {
+    EmplaceAfter(cbefore_begin(), std::move(value));
+}
+
+template <typename Type, size_t N>
+template <typename... Args>
+constexpr Type& StaticSingleLinkedList<Type, N>::EmplaceFront(Args&&... args) {
+    return *EmplaceAfter(cbefore_begin(), std::forward<Args>(args)...);
+}
+
+template <typename Type, size_t N>
+constexpr void StaticSingleLinkedList<Type, N>::PopFront() noexcept(std::is_nothrow_move_assignable_v<Type>) {
+    assert(size_ > 0);
+    EraseAfter(cbefore_begin());
+}
+
+template <typename Type, size_t N>
+constexpr Type& StaticSingleLinkedList<Type, N>::Front() noexcept {
+    assert(size_ > 0);
+    return values_[next_[HEAD]];
+}
+
+template <typename Type, size_t N>
+constexpr const Type& StaticSingleLinkedList<Type, N>::Front() const noexcept {
+    assert(size_ > 0);
+    return values_[next_[HEAD]];
+}
+
+template <typename Type, size_t N>
+constexpr void StaticSingleLinkedList<Type, N>::Clear() noexcept(std::is_nothrow_move_assignable_v<Type>) {
+    for (Index index = next_[HEAD]; index != NIL; index = next_[index]) {
+        values_[index] = Type();
+    }
+    next_[HEAD] = NIL;
+    used_ = 0;
+    free_ = NIL;
+    size_ = 0;
+}
+
+template <typename Type, size_t N>
+constexpr size_t StaticSingleLinkedList<Type, N>::GetSize() const noexcept {
+    return size_;
+}
+
+template <typename Type, size_t N>
+constexpr bool StaticSingleLinkedList<Type, N>::IsEmpty() const noexcept {
+    return size_ == 0;
+}
+
+template <typename Type, size_t N>
+constexpr bool StaticSingleLinkedList<Type, N>::IsFull() const noexcept {
+    return size_ == N;
+}
+
+template <typename Type, size_t N>
+constexpr int StaticSingleLinkedList<Type, N>::CompareTo(const StaticSingleLinkedList& other) const {
+    auto lhs = begin();
+    auto rhs = other.begin();
+    for (; lhs != end() && rhs != other.end(); ++lhs, ++rhs) {
+        if (*lhs < *rhs) {
+            return -1;
+        }
+        if (*rhs < *lhs) {
+            return 1;
+        }
+    }
+    if (lhs == end()) {
+        return rhs == other.end() ? 0 : -1;
+    }
+    return 1;
+}
+
+template <typename Type, size_t N>
+constexpr typename StaticSingleLinkedList<Type, N>::Index StaticSingleLinkedList<Type, N>::AcquireSlot() {
+    if (free_ != NIL) {
+        const Index slot = free_;
+        free_ = next_[slot];
+        return slot;
+    }
+    assert(used_ < N);
+    return used_++;
+}
+
+template <typename Type, size_t N>
+constexpr void StaticSingleLinkedList<Type, N>::LinkSlot(Index prev, Index slot) noexcept {
+    next_[slot] = next_[prev];
+    next_[prev] = slot;
+    ++size_;
+}
+
+template <typename Type, size_t N>
+constexpr void swap(StaticSingleLinkedList<Type, N>& lhs, StaticSingleLinkedList<Type, N>& rhs) noexcept(noexcept(lhs.swap(rhs))) {
+    lhs.swap(rhs);
+}
+
+template <typename Type, size_t N>
+constexpr bool operator==(const StaticSingleLinkedList<Type, N>& lhs, const StaticSingleLinkedList<Type, N>& rhs) {
+    if (lhs.GetSize() != rhs.GetSize()) {
+        return false;
+    }
+    for (auto l = lhs.begin(), r = rhs.begin(); l != lhs.end(); ++l, ++r) {
+        if (!(*l == *r)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename Type, size_t N>
+constexpr bool operator!=(const StaticSingleLinkedList<Type, N>& lhs, const StaticSingleLinkedList<Type, N>& rhs) {
+    return !(lhs == rhs);
+}
+
+template <typename Type, size_t N>
+constexpr bool operator<(const StaticSingleLinkedList<Type, N>& lhs, const StaticSingleLinkedList<Type, N>& rhs) {
+    return lhs.CompareTo(rhs) < 0;
+}
+
+template <typename Type, size_t N>
+constexpr bool operator>(const StaticSingleLinkedList<Type, N>& lhs, const StaticSingleLinkedList<Type, N>& rhs) {
+    return lhs.CompareTo(rhs) > 0;
+}
+
+template <typename Type, size_t N>
+constexpr bool operator<=(const StaticSingleLinkedList<Type, N>& lhs, const StaticSingleLinkedList<Type, N>& rhs) {
+    return lhs.CompareTo(rhs) <= 0;
+}
+
+template <typename Type, size_t N>
+constexpr bool operator>=(const StaticSingleLinkedList<Type, N>& lhs, const StaticSingleLinkedList<Type, N>& rhs) {
+    return lhs.CompareTo(rhs) >= 0;
+}
@@ -0,0 +1,187 @@
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if __cplusplus > 201703L
+#include <coroutine>
+
+namespace async_channel_test {
+
+// Корутина, которая начинает работу сразу и сама разрушает свой кадр по завершении
+struct DetachedTask {
+    struct promise_type {
+        DetachedTask get_return_object() noexcept {
+            return {};
+        }
+        std::suspend_never initial_suspend() noexcept {
+            return {};
+        }
+        std::suspend_never final_suspend() noexcept {
+            return {};
+        }
+        void return_void() noexcept {
+        }
+        void unhandled_exception() noexcept {
+            std::terminate();
+        }
+    };
+};
+
+// Забирает значения из канала, пока он не закрыт
+template <typename Type>
+DetachedTask Consume(AsyncSingleLinkedChannel<Type>& channel, std::vector<Type>& received, bool& finished) {
+    while (auto value = co_await channel.Pop()) {
+        received.push_back(std::move(*value));
+    }
+    finished = true;
+}
+
+// Забирает значения из канала, пока он не закрыт, в многопоточном тесте
+DetachedTask ConsumeShared(AsyncSingleLinkedChannel<int>& channel, std::atomic<long long>& sum,
+                           std::atomic<int>& received, std::atomic<int>& finished) {
+    while (auto value = co_await channel.Pop()) {
+        sum += *value;
+        ++received;
+    }
+    ++finished;
+}
+
+}  // namespace async_channel_test
+#endif
+
+// Эта функция проверяет работу AsyncSingleLinkedChannel
+void TestAsyncChannel() {
+#if __cplusplus > 201703L
+    using namespace std;
+    using namespace async_channel_test;
+
+    // Без ожидания: TryPop и co_await на непустом канале
+    {
+        AsyncSingleLinkedChannel<string> channel;
+        assert(!channel.TryPop().has_value());
+        channel.Push("a"s);
+        channel.Emplace(2, 'b');
+        assert(channel.TryPop() == "a"s);
+        assert(!channel.IsClosed());
+        channel.Close();
+        assert(channel.IsClosed());
+
+        // Корутина завершается, ни разу не приостановившись
+        vector<string> received;
+        bool finished = false;
+        Consume(channel, received, finished);
+        assert(finished);
+        assert((received == vector<string>{"bb"}));
+    }
+
+    // Корутина приостанавливается на пустом канале и возобновляется в потоке, вызвавшем Push
+    {
+        AsyncSingleLinkedChannel<unique_ptr<int>> channel;
+        vector<unique_ptr<int>> received;
+        bool finished = false;
+        Consume(channel, received, finished);
+        assert(received.empty() && !finished);
+
+        channel.Push(make_unique<int>(1));
+        assert(received.size() == 1u && *received[0] == 1);
+        channel.Push(make_unique<int>(2));
+        assert(received.size() == 2u && *received[1] == 2);
+        assert(!finished);
+        channel.Close();
+        assert(finished);
+        assert(!channel.TryPop().has_value());
+    }
+
+    // Отложенный планировщик: серия Push приводит к одному возобновлению
+    {
+        vector<coroutine_handle<>> ready;
+        AsyncSingleLinkedChannel<int> channel([&ready](coroutine_handle<> handle) {
+            ready.push_back(handle);
+        });
+        const auto run_ready = [&ready] {
+            while (!ready.empty()) {
+                const auto handle = ready.back();
+                ready.pop_back();
+                handle.resume();
+            }
+        };
+
+        vector<int> received;
+        bool finished = false;
+        Consume(channel, received, finished);
+        for (int i = 0; i < 5; ++i) {
+            channel.Push(i);
+        }
+        assert(ready.size() == 1u);
+        run_ready();
+        assert((received == vector<int>{0, 1, 2, 3, 4}));
+        assert(ready.empty());
+
+        // Пакет будит не больше корутин, чем в нём значений
+        vector<int> other_received;
+        bool other_finished = false;
+        Consume(channel, other_received, other_finished);
+        const vector<int> one{5};
+        channel.PushBatch(one.begin(), one.end());
+        assert(ready.size() == 1u);
+        run_ready();
+        assert(received.size() + other_received.size() == 6u);
+
+        const vector<int> batch{6, 7, 8, 9};
+        channel.PushBatch(batch.begin(), batch.end());
+        channel.PushBatch(batch.begin(), batch.begin());
+        assert(ready.size() == 2u);
+        run_ready();
+        assert(received.size() + other_received.size() == 10u);
+
+        // Закрытие будит все ожидающие корутины
+        channel.Close();
+        assert(ready.size() == 2u);
+        run_ready();
+        assert(finished && other_finished);
+    }
+
+    // Производители в разных потоках, корутины возобновляются в потоках производителей
+    {
+        constexpr int THREAD_COUNT = 4;
+        constexpr int ITEMS_PER_THREAD = 10000;
+        constexpr int CONSUMER_COUNT = 3;
+        AsyncSingleLinkedChannel<int> channel;
+        atomic<long long> sum = 0;
+        atomic<int> received = 0;
+        atomic<int> finished = 0;
+        for (int i = 0; i < CONSUMER_COUNT; ++i) {
+            ConsumeShared(channel, sum, received, finished);
+        }
+
+        vector<thread> threads;
+        for (int t = 0; t < THREAD_COUNT; ++t) {
+            threads.emplace_back([&channel, t] {
+                for (int i = 0; i < ITEMS_PER_THREAD; ++i) {
+                    if (i % 10 == 0) {
+                        const vector<int> batch(5, t);
+                        channel.PushBatch(batch.begin(), batch.end());
+                    }
+                    channel.Push(1);
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        channel.Close();
+        assert(finished == CONSUMER_COUNT);
+        assert(received == THREAD_COUNT * ITEMS_PER_THREAD * 3 / 2);
+        assert(sum == THREAD_COUNT * ITEMS_PER_THREAD + (0 + 1 + 2 + 3) * ITEMS_PER_THREAD / 2);
+    }
+
+    std::cerr << "ASYNC CHANNEL TEST OK" << std::endl;
+#endif
+}
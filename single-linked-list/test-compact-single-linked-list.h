@@ -0,0 +1,191 @@
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <forward_list>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Эта функция проверяет работу CompactSingleLinkedList
+void TestCompactList() {
+    using namespace std;
+    using IntList = CompactSingleLinkedList<int32_t>;
+
+    // Узел хранит значение и 32-битный индекс следующего узла
+    static_assert(sizeof(IntList::value_type) + sizeof(uint32_t) == 8);
+
+    // Пустой список не выделяет память
+    {
+        const IntList list;
+        assert(list.IsEmpty());
+        assert(list.GetSize() == 0u);
+        assert(list.GetCapacity() == 0u);
+        assert(list.begin() == list.end());
+        assert(++list.cbefore_begin() == list.cbegin());
+
+        const IntList copy(list);
+        assert(copy.GetCapacity() == 0u);
+    }
+
+    // Вставка и удаление повторяют поведение std::forward_list
+    {
+        IntList list;
+        forward_list<int32_t> expected;
+        for (int32_t i = 0; i < 100; ++i) {
+            list.PushFront(i);
+            expected.push_front(i);
+        }
+        auto pos = list.begin();
+        auto expected_pos = expected.begin();
+        for (int32_t i = 0; i < 50; ++i) {
+            pos = list.InsertAfter(pos, -i);
+            expected_pos = expected.insert_after(expected_pos, -i);
+            ++pos;
+            ++expected_pos;
+        }
+        assert(equal(list.begin(), list.end(), expected.begin(), expected.end()));
+        assert(list.GetSize() == 150u);
+
+        list.EraseAfter(list.cbefore_begin());
+        expected.erase_after(expected.cbefore_begin());
+        list.PopFront();
+        expected.pop_front();
+        const auto next = list.EraseAfter(list.cbegin());
+        const auto expected_next = expected.erase_after(expected.cbegin());
+        assert(*next == *expected_next);
+        assert(equal(list.begin(), list.end(), expected.begin(), expected.end()));
+        assert(list.GetSize() == 147u);
+    }
+
+    // Освобождённые ячейки используются повторно, массив не растёт
+    {
+        IntList list{1, 2, 3, 4};
+        const size_t capacity = list.GetCapacity();
+        for (int i = 0; i < 1000; ++i) {
+            list.PopFront();
+            list.PushFront(i);
+        }
+        assert(list.GetCapacity() == capacity);
+        assert((list == IntList{999, 2, 3, 4}));
+
+        list.Clear();
+        assert(list.IsEmpty());
+        assert(list.GetCapacity() == capacity);
+        list.PushFront(7);
+        assert((list == IntList{7}));
+    }
+
+    // Reserve выделяет массив заранее
+    {
+        IntList list;
+        list.Reserve(1000);
+        assert(list.GetCapacity() >= 1000u);
+        const size_t capacity = list.GetCapacity();
+        for (int i = 0; i < 1000; ++i) {
+            list.PushFront(i);
+        }
+        assert(list.GetCapacity() == capacity);
+    }
+
+    // Элементы с нетривиальным конструктором переносятся при росте массива
+    {
+        CompactSingleLinkedList<string> list;
+        vector<string> expected;
+        auto pos = list.before_begin();
+        for (int i = 0; i < 100; ++i) {
+            pos = list.InsertAfter(pos, "a string long enough to need heap memory " + to_string(i));
+            expected.push_back("a string long enough to need heap memory " + to_string(i));
+        }
+        assert(equal(list.begin(), list.end(), expected.begin(), expected.end()));
+
+        // Аргумент может ссылаться на элемент списка, даже если массив растёт
+        CompactSingleLinkedList<string> single{"value"};
+        while (single.GetSize() < single.GetCapacity()) {
+            single.PushFront("value");
+        }
+        single.PushFront(*single.begin());
+        assert(single.GetSize() > single.GetCapacity() / 2);
+        assert(*single.begin() == "value");
+    }
+
+    // Копирование, перемещение и сравнение
+    {
+        IntList list{1, 2, 3};
+        IntList copy(list);
+        assert(copy == list);
+        copy.PushFront(0);
+        assert(copy != list);
+        assert(!(list < copy));
+        assert(copy < list);
+
+        IntList moved(std::move(copy));
+        assert(copy.IsEmpty());
+        assert((moved == IntList{0, 1, 2, 3}));
+
+        copy = moved;
+        assert(copy == moved);
+        list = std::move(moved);
+        assert((list == IntList{0, 1, 2, 3}));
+
+        swap(list, copy);
+        assert(list == copy);
+    }
+
+    // Исключение при создании элемента не меняет список
+    {
+        struct ThrowOnCopy {
+            ThrowOnCopy() = default;
+            ThrowOnCopy(const ThrowOnCopy& other)
+                : value(other.value) {
+                if (value < 0) {
+                    throw runtime_error("copy failed");
+                }
+            }
+            ThrowOnCopy& operator=(const ThrowOnCopy&) = default;
+            int value = 0;
+        };
+        CompactSingleLinkedList<ThrowOnCopy> list;
+        ThrowOnCopy good;
+        good.value = 1;
+        list.PushFront(good);
+        ThrowOnCopy bad;
+        bad.value = -1;
+        for (int i = 0; i < 40; ++i) {
+            try {
+                list.PushFront(bad);
+                assert(false);
+            } catch (const runtime_error&) {
+            }
+            list.PushFront(good);
+        }
+        assert(list.GetSize() == 41u);
+        assert(list.GetCapacity() < 128u);
+    }
+
+    // Сравнение за один проход и проверка длины до обхода
+    {
+        IntList lhs{1, 2, 3};
+        IntList rhs;
+        auto pos = rhs.cbefore_begin();
+        for (int32_t value : {1, 2, 3}) {
+            pos = rhs.InsertAfter(pos, value);
+        }
+        rhs.PushFront(0);
+        rhs.PopFront();
+        assert(lhs.CompareTo(rhs) == 0);
+        assert(lhs == rhs && lhs <= rhs && lhs >= rhs);
+        rhs.PushFront(0);
+        assert(lhs.CompareTo(rhs) > 0);
+        assert(rhs < lhs && lhs > rhs && lhs != rhs);
+        assert(IntList{}.CompareTo(IntList{}) == 0);
+        assert((IntList{1, 2} < IntList{1, 2, 3}));
+        assert((IntList{1, 2, 3}.CompareTo(IntList{1, 2}) > 0));
+#if __cplusplus > 201703L
+        assert((lhs <=> rhs) == std::weak_ordering::greater);
+#endif
+    }
+
+    std::cerr << "COMPACT TEST OK" << std::endl;
+}
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Эта функция проверяет работу ConcurrentSingleLinkedList и ConcurrentSingleLinkedQueue
+void TestConcurrentList() {
+    using namespace std;
+    constexpr int THREAD_COUNT = 4;
+    constexpr int ITEMS_PER_THREAD = 20000;
+
+    // Однопоточная работа стека
+    {
+        ConcurrentSingleLinkedList<string> stack;
+        assert(stack.IsEmpty());
+        assert(!stack.PopFront().has_value());
+        stack.PushFront("one"s);
+        stack.EmplaceFront(3, 'a');
+        const vector<string> chain{"x"s, "y"s};
+        stack.PushFrontChain(chain.begin(), chain.end());
+        assert(!stack.IsEmpty());
+        assert(stack.PopFront() == "x"s);
+        assert(stack.PopFront() == "y"s);
+        assert(stack.PopFront() == "aaa"s);
+        assert(stack.PopFront() == "one"s);
+        assert(!stack.PopFront().has_value());
+        assert(stack.IsEmpty());
+    }
+
+    // Однопоточная работа очереди
+    {
+        ConcurrentSingleLinkedQueue<unique_ptr<int>> queue;
+        assert(queue.IsEmpty());
+        assert(!queue.PopFront().has_value());
+        queue.PushBack(make_unique<int>(1));
+        queue.EmplaceBack(make_unique<int>(2));
+        assert(!queue.IsEmpty());
+        assert(*queue.PopFront().value() == 1);
+        assert(*queue.PopFront().value() == 2);
+        assert(!queue.PopFront().has_value());
+
+        ConcurrentSingleLinkedQueue<int> numbers;
+        const vector<int> chain{1, 2, 3};
+        numbers.PushBack(0);
+        numbers.PushBackChain(chain.begin(), chain.end());
+        numbers.PushBack(4);
+        for (int expected = 0; expected <= 4; ++expected) {
+            assert(numbers.PopFront() == expected);
+        }
+        assert(numbers.IsEmpty());
+    }
+
+    // Одновременная работа нескольких производителей и потребителей со стеком.
+    // Каждый элемент должен быть извлечён ровно один раз
+    {
+        ConcurrentSingleLinkedList<int> stack;
+        vector<atomic<int>> seen(THREAD_COUNT * ITEMS_PER_THREAD);
+        atomic<int> popped = 0;
+        vector<thread> threads;
+        for (int t = 0; t < THREAD_COUNT; ++t) {
+            threads.emplace_back([&, t] {
+                for (int i = 0; i < ITEMS_PER_THREAD; ++i) {
+                    if (i % 4 == 0) {
+                        const int base = t * ITEMS_PER_THREAD + i;
+                        const vector<int> chain{base, base + 1, base + 2, base + 3};
+                        stack.PushFrontChain(chain.begin(), chain.end());
+                    }
+                    if (auto value = stack.PopFront()) {
+                        ++seen[*value];
+                        ++popped;
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        while (auto value = stack.PopFront()) {
+            ++seen[*value];
+            ++popped;
+        }
+        assert(popped == THREAD_COUNT * ITEMS_PER_THREAD);
+        for (const auto& counter : seen) {
+            assert(counter == 1);
+        }
+    }
+
+    // Одновременная работа нескольких производителей и потребителей с очередью.
+    // Элементы одного производителя извлекаются в порядке вставки
+    {
+        ConcurrentSingleLinkedQueue<pair<int, int>> queue;
+        atomic<int> popped = 0;
+        atomic<bool> order_ok = true;
+        vector<thread> threads;
+        for (int t = 0; t < THREAD_COUNT; ++t) {
+            threads.emplace_back([&, t] {
+                for (int i = 0; i < ITEMS_PER_THREAD; ++i) {
+                    queue.PushBack({t, i});
+                }
+            });
+        }
+        for (int t = 0; t < THREAD_COUNT; ++t) {
+            threads.emplace_back([&] {
+                vector<int> last_seen(THREAD_COUNT, -1);
+                while (popped.load() < THREAD_COUNT * ITEMS_PER_THREAD) {
+                    if (auto item = queue.PopFront()) {
+                        if (item->second <= last_seen[item->first]) {
+                            order_ok = false;
+                        }
+                        last_seen[item->first] = item->second;
+                        ++popped;
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        assert(order_ok);
+        assert(popped == THREAD_COUNT * ITEMS_PER_THREAD);
+        assert(queue.IsEmpty());
+    }
+
+    std::cerr << "CONCURRENT TEST OK" << std::endl;
+}
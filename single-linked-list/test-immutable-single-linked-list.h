@@ -0,0 +1,166 @@
+#pragma once
+
+#include <cassert>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// Эта функция проверяет работу ImmutableSingleLinkedList
+void TestImmutableList() {
+    using namespace std;
+    using List = ImmutableSingleLinkedList<string>;
+
+    // Пустой список
+    {
+        const List list;
+        assert(list.IsEmpty());
+        assert(list.GetSize() == 0u);
+        assert(list.begin() == list.end());
+        const List copy(list);
+        assert(copy.IsSameAs(list));
+        assert(copy == list);
+    }
+
+    // Копия разделяет узлы, PushFront и PopFront не затрагивают другие списки
+    {
+        const List base{"b", "c"};
+        List with_a = base;
+        assert(with_a.IsSameAs(base));
+        with_a.PushFront("a");
+        assert((with_a == List{"a", "b", "c"}));
+        assert((base == List{"b", "c"}));
+        // Хвост нового списка - узлы исходного
+        assert(&*++with_a.begin() == &base.Front());
+
+        List other = base;
+        other.EmplaceFront(3, 'x');
+        assert(other.Front() == "xxx");
+        assert(&*++other.begin() == &base.Front());
+
+        with_a.PopFront();
+        assert(with_a.IsSameAs(base));
+        with_a.PopFront();
+        assert(with_a.GetSize() == 1u);
+        assert(&with_a.Front() == &*++base.begin());
+        with_a.Clear();
+        assert(with_a.IsEmpty());
+        assert(base.GetSize() == 2u);
+    }
+
+    // Присваивание, перемещение и обмен
+    {
+        List first{"1", "2"};
+        List second{"3"};
+        first = first;
+        assert(first.GetSize() == 2u);
+        second = first;
+        assert(second.IsSameAs(first));
+        List moved(std::move(second));
+        assert(second.IsEmpty());
+        assert(moved.IsSameAs(first));
+        second = std::move(moved);
+        assert(moved.IsEmpty());
+        assert(second == first);
+
+        List third{"0"};
+        swap(third, second);
+        assert(third.IsSameAs(first));
+        assert((second == List{"0"}));
+        assert(second < first && first > second && second <= first && first >= second && first != second);
+    }
+
+    // Преобразование из SingleLinkedList и обратно
+    {
+        SingleLinkedList<int> source{1, 2, 3};
+        const ImmutableSingleLinkedList<int> shared(source);
+        source.PushFront(0);
+        assert((shared == ImmutableSingleLinkedList<int>{1, 2, 3}));
+
+        auto copy = shared.ToSingleLinkedList();
+        static_assert(std::is_same_v<decltype(copy), SingleLinkedList<int>>);
+        assert((copy == SingleLinkedList<int>{1, 2, 3}));
+        const auto tracked = shared.ToSingleLinkedList<SingleLinkedList<int, std::allocator<int>, TailTracking>>();
+        assert(tracked.Back() == 3);
+
+        // Однопроходный диапазон
+        istringstream input("4 5 6");
+        const ImmutableSingleLinkedList<int> from_stream{istream_iterator<int>(input), istream_iterator<int>()};
+        assert((from_stream == ImmutableSingleLinkedList<int>{4, 5, 6}));
+    }
+
+    // Исключение при создании элемента не меняет список
+    {
+        struct ThrowOnCopy {
+            ThrowOnCopy() = default;
+            ThrowOnCopy(const ThrowOnCopy& other)
+                : copies(other.copies + 1) {
+                if (copies > 1) {
+                    throw runtime_error("copy");
+                }
+            }
+            int copies = 0;
+        };
+        vector<ThrowOnCopy> values(3);
+        values[2].copies = 1;
+        bool exception_was_thrown = false;
+        try {
+            ImmutableSingleLinkedList<ThrowOnCopy> list(values.begin(), values.end());
+        } catch (const runtime_error&) {
+            exception_was_thrown = true;
+        }
+        assert(exception_was_thrown);
+
+        ImmutableSingleLinkedList<ThrowOnCopy> list(values.begin(), values.begin() + 2);
+        exception_was_thrown = false;
+        try {
+            list.PushFront(values[2]);
+        } catch (const runtime_error&) {
+            exception_was_thrown = true;
+        }
+        assert(exception_was_thrown);
+        assert(list.GetSize() == 2u);
+    }
+
+    // Длинный список освобождается без рекурсии
+    {
+        ImmutableSingleLinkedList<int> list;
+        for (int i = 0; i < 1'000'000; ++i) {
+            list.PushFront(i);
+        }
+        const auto copy = list;
+        list.Clear();
+        assert(copy.Front() == 999'999);
+    }
+
+    // Копии одного списка можно использовать и разрушать в разных потоках
+    {
+        List shared;
+        for (int i = 0; i < 100; ++i) {
+            shared.PushFront(to_string(i));
+        }
+        vector<thread> threads;
+        for (int t = 0; t < 4; ++t) {
+            threads.emplace_back([copy = shared]() mutable {
+                for (int i = 0; i < 1000; ++i) {
+                    List local = copy;
+                    local.PushFront("x");
+                    local.PopFront();
+                    local.PopFront();
+                    assert(local.GetSize() == 99u);
+                }
+            });
+        }
+        for (thread& thread : threads) {
+            thread.join();
+        }
+        assert(shared.GetSize() == 100u);
+        assert(shared.Front() == "99");
+    }
+
+    std::cerr << "IMMUTABLE TEST OK" << std::endl;
+}
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace intrusive_test {
+
+struct ByAgeTag {};
+
+// Элемент, который может одновременно находиться в двух списках
+struct Person : IntrusiveListHook<>, IntrusiveListHook<ByAgeTag> {
+    Person(std::string name, int age)
+        : name(std::move(name))
+        , age(age) {
+    }
+
+    std::string name;
+    int age = 0;
+};
+
+}  // namespace intrusive_test
+
+// Эта функция проверяет работу IntrusiveSingleLinkedList
+void TestIntrusiveList() {
+    using namespace std;
+    using intrusive_test::ByAgeTag;
+    using intrusive_test::Person;
+    using PersonList = IntrusiveSingleLinkedList<Person>;
+
+    // Пустой список
+    {
+        const PersonList list;
+        assert(list.IsEmpty());
+        assert(list.GetSize() == 0u);
+        assert(list.begin() == list.end());
+        assert(++list.cbefore_begin() == list.cbegin());
+    }
+
+    // Вставка и удаление только переставляют указатели, адреса элементов не меняются
+    {
+        vector<Person> people{{"Ann", 30}, {"Bob", 25}, {"Carl", 40}};
+        PersonList list;
+        list.PushFront(people[2]);
+        list.PushFront(people[0]);
+        const auto bob = list.InsertAfter(list.cbegin(), people[1]);
+        assert(&*bob == &people[1]);
+        assert(list.GetSize() == 3u);
+        assert(&list.Front() == &people[0]);
+
+        vector<string> names;
+        for (const Person& person : list) {
+            names.push_back(person.name);
+        }
+        assert((names == vector<string>{"Ann", "Bob", "Carl"}));
+
+        // Итератор на элемент можно получить по ссылке на него
+        assert(PersonList::IteratorTo(people[1]) == bob);
+        const auto carl = list.EraseAfter(PersonList::IteratorTo(people[0]));
+        assert(&*carl == &people[2]);
+        assert(list.GetSize() == 2u);
+
+        list.PopFront();
+        assert(&list.Front() == &people[2]);
+        assert(list.GetSize() == 1u);
+
+        // Отсоединённый элемент можно вставить снова
+        list.PushFront(people[1]);
+        list.InsertAfter(list.cbegin(), people[0]);
+        names.clear();
+        for (const Person& person : list) {
+            names.push_back(person.name);
+        }
+        assert((names == vector<string>{"Bob", "Ann", "Carl"}));
+
+        list.Clear();
+        assert(list.IsEmpty());
+        list.PushFront(people[2]);
+        assert(list.GetSize() == 1u);
+    }
+
+    // Элемент находится в двух списках через хуки с разными тегами
+    {
+        vector<Person> people{{"Ann", 30}, {"Bob", 25}, {"Carl", 40}};
+        PersonList by_name;
+        IntrusiveSingleLinkedList<Person, ByAgeTag> by_age;
+        for (auto it = people.rbegin(); it != people.rend(); ++it) {
+            by_name.PushFront(*it);
+        }
+        by_age.PushFront(people[2]);
+        by_age.PushFront(people[0]);
+        by_age.PushFront(people[1]);
+
+        vector<int> ages;
+        for (const Person& person : by_age) {
+            ages.push_back(person.age);
+        }
+        assert(is_sorted(ages.begin(), ages.end()));
+        assert(by_name.Front().name == "Ann");
+
+        for (Person& person : by_age) {
+            ++person.age;
+        }
+        assert(by_name.Front().age == 31);
+    }
+
+    // Перемещение и обмен передают элементы за время O(1)
+    {
+        vector<Person> people{{"Ann", 30}, {"Bob", 25}};
+        PersonList list;
+        list.PushFront(people[0]);
+        PersonList moved(std::move(list));
+        assert(list.IsEmpty());
+        assert(&moved.Front() == &people[0]);
+
+        PersonList other;
+        other.PushFront(people[1]);
+        swap(moved, other);
+        assert(&moved.Front() == &people[1]);
+        assert(&other.Front() == &people[0]);
+
+        moved = std::move(other);
+        assert(other.IsEmpty());
+        assert(moved.GetSize() == 1u);
+        assert(&moved.Front() == &people[0]);
+    }
+
+    // Копия элемента не находится в списке
+    {
+        Person ann("Ann", 30);
+        PersonList list;
+        list.PushFront(ann);
+        Person bob("Bob", 25);
+        list.PushFront(bob);
+        Person copy(bob);
+        PersonList other;
+        other.PushFront(copy);
+        assert(other.GetSize() == 1u);
+        assert(++other.begin() == other.end());
+    }
+
+    std::cerr << "INTRUSIVE TEST OK" << std::endl;
+}
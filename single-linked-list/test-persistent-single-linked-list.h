@@ -0,0 +1,177 @@
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+#include <forward_list>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <unistd.h>
+
+// Эта функция проверяет работу PersistentSingleLinkedList
+void TestPersistentList() {
+    using namespace std;
+    using List = PersistentSingleLinkedList<int64_t>;
+
+    const string path = "/tmp/persistent-single-linked-list-test-" + to_string(::getpid()) + ".bin";
+    std::remove(path.c_str());
+
+    // Новый файл содержит пустой список
+    {
+        List list(path);
+        assert(list.IsEmpty());
+        assert(list.GetSize() == 0u);
+        assert(list.begin() == list.end());
+        assert(++list.cbefore_begin() == list.cbegin());
+        assert(!list.IsReadOnly());
+    }
+
+    // Элементы сохраняются в файле и доступны после повторного открытия
+    {
+        List list(path);
+        list.PushFront(3);
+        list.PushFront(1);
+        const auto two = list.InsertAfter(list.cbegin(), 2);
+        assert(*two == 2);
+        assert(list.GetSize() == 3u);
+        list.Front() = 0;
+        list.Sync();
+    }
+    {
+        const List list(path, PersistentOpenMode::ReadOnly);
+        assert(list.IsReadOnly());
+        assert(list.GetSize() == 3u);
+        forward_list<int64_t> values(list.begin(), list.end());
+        assert((values == forward_list<int64_t>{0, 2, 3}));
+        assert(list.Front() == 0);
+    }
+
+    // Список, открытый только для чтения, нельзя изменять
+    {
+        List list(path, PersistentOpenMode::ReadOnly);
+        bool exception_was_thrown = false;
+        try {
+            list.PushFront(42);
+        } catch (const logic_error&) {
+            exception_was_thrown = true;
+        }
+        assert(exception_was_thrown);
+        assert(list.GetSize() == 3u);
+
+        // Изменяемый доступ к элементам тоже запрещён, читать можно через константные методы
+        exception_was_thrown = false;
+        try {
+            [[maybe_unused]] auto it = list.begin();
+        } catch (const logic_error&) {
+            exception_was_thrown = true;
+        }
+        assert(exception_was_thrown);
+        exception_was_thrown = false;
+        try {
+            [[maybe_unused]] auto it = list.before_begin();
+        } catch (const logic_error&) {
+            exception_was_thrown = true;
+        }
+        assert(exception_was_thrown);
+        exception_was_thrown = false;
+        try {
+            [[maybe_unused]] int64_t& front = list.Front();
+        } catch (const logic_error&) {
+            exception_was_thrown = true;
+        }
+        assert(exception_was_thrown);
+        assert(*list.cbegin() == 0);
+        assert(std::as_const(list).Front() == 0);
+    }
+
+    // Удалённые узлы используются повторно, а при нехватке места файл увеличивается
+    {
+        List list(path);
+        list.EraseAfter(list.cbegin());
+        assert(list.GetSize() == 2u);
+        list.PopFront();
+        assert(list.Front() == 3);
+
+        constexpr int64_t COUNT = 100000;
+        auto pos = list.cbegin();
+        for (int64_t i = 0; i < COUNT; ++i) {
+            pos = list.InsertAfter(pos, i);
+        }
+        assert(list.GetSize() == static_cast<size_t>(COUNT) + 1);
+
+        List moved(std::move(list));
+        list = std::move(moved);
+        assert(list.GetSize() == static_cast<size_t>(COUNT) + 1);
+    }
+    {
+        const List list(path, PersistentOpenMode::ReadOnly);
+        auto it = list.begin();
+        assert(*it == 3);
+        int64_t expected = 0;
+        for (++it; it != list.end(); ++it) {
+            assert(*it == expected++);
+        }
+        assert(expected == 100000);
+    }
+
+    // Reserve избавляет от повторного отображения, Clear освобождает всю область узлов
+    {
+        List list(path);
+        list.Clear();
+        assert(list.IsEmpty());
+        list.Reserve(10);
+        const auto first = list.InsertAfter(list.before_begin(), 7);
+        list.PushFront(5);
+        assert(*first == 7);
+        assert(list.GetSize() == 2u);
+    }
+
+    // Вставка элемента самого списка не теряет значение, когда файл увеличивается и отображается заново
+    {
+        const string grown = path + ".grown";
+        std::remove(grown.c_str());
+        {
+            List list(grown);
+            list.PushFront(42);
+            constexpr size_t COUNT = 20000;
+            for (size_t i = 1; i < COUNT; ++i) {
+                if (i % 2 == 0) {
+                    list.PushFront(list.Front());
+                } else {
+                    list.InsertAfter(list.cbegin(), *list.cbegin());
+                }
+            }
+            assert(list.GetSize() == COUNT);
+            for (auto it = list.cbegin(); it != list.cend(); ++it) {
+                assert(*it == 42);
+            }
+        }
+        std::remove(grown.c_str());
+    }
+
+    // Файл другого типа или не являющийся списком не открывается
+    {
+        bool exception_was_thrown = false;
+        try {
+            PersistentSingleLinkedList<char> other(path, PersistentOpenMode::ReadOnly);
+        } catch (const runtime_error&) {
+            exception_was_thrown = true;
+        }
+        assert(exception_was_thrown);
+
+        const string missing = path + ".missing";
+        exception_was_thrown = false;
+        try {
+            List other(missing, PersistentOpenMode::ReadOnly);
+        } catch (const system_error&) {
+            exception_was_thrown = true;
+        }
+        assert(exception_was_thrown);
+    }
+
+    std::remove(path.c_str());
+    std::cerr << "PERSISTENT TEST OK" << std::endl;
+}
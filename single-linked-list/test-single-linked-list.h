@@ -1,8 +1,24 @@
 #pragma once
 
 #include <iostream>
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <cstdint>
+#include <forward_list>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <stdexcept>
 #include <string>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 void Test0() {
     using namespace std;
@@ -710,6 +726,2345 @@ void Test5() {
     }
 }
 
+// Счётчики выделений и освобождений памяти аллокатором CountingAllocator
+struct AllocationCounters {
+    int allocations = 0;
+    int deallocations = 0;
+
+    static AllocationCounters& Instance() {
+        static AllocationCounters counters;
+        return counters;
+    }
+};
+
+// Аллокатор, подсчитывающий выделения и освобождения памяти
+template <typename Type>
+struct CountingAllocator {
+    using value_type = Type;
+
+    CountingAllocator() = default;
+
+    template <typename Other>
+    CountingAllocator(const CountingAllocator<Other>&) noexcept {
+    }
+
+    Type* allocate(size_t n) {
+        ++AllocationCounters::Instance().allocations;
+        return std::allocator<Type>{}.allocate(n);
+    }
+
+    void deallocate(Type* ptr, size_t n) noexcept {
+        ++AllocationCounters::Instance().deallocations;
+        std::allocator<Type>{}.deallocate(ptr, n);
+    }
+
+    template <typename Other>
+    bool operator==(const CountingAllocator<Other>&) const noexcept {
+        return true;
+    }
+
+    template <typename Other>
+    bool operator!=(const CountingAllocator<Other>&) const noexcept {
+        return false;
+    }
+};
+
+// Эта функция проверяет работу SingleLinkedList с пользовательскими аллокаторами
+void Test6() {
+    {
+        auto& counters = AllocationCounters::Instance();
+        counters = {};
+        {
+            SingleLinkedList<int, CountingAllocator<int>> list{1, 2, 3};
+            assert(list.GetSize() == 3u);
+            assert(counters.allocations == 3);
+            list.PushFront(0);
+            list.InsertAfter(list.cbegin(), 10);
+            assert(counters.allocations == 5);
+            list.PopFront();
+            list.EraseAfter(list.cbegin());
+            assert(counters.deallocations == 2);
+            assert((list == SingleLinkedList<int, CountingAllocator<int>>{10, 2, 3}));
+        }
+        assert(counters.allocations == counters.deallocations);
+    }
+
+    // Узлы, освобождённые в пуле, используются повторно
+    {
+        using PoolList = SingleLinkedList<std::string, PoolAllocator<std::string>>;
+        PoolList list{"a", "b", "c"};
+        const auto* first_address = &*list.begin();
+        list.PopFront();
+        list.PushFront("d");
+        assert(&*list.begin() == first_address);
+        assert((list == PoolList{"d", "b", "c"}));
+
+        PoolList copy(list);
+        assert(copy == list);
+        copy.Clear();
+        assert(copy.IsEmpty());
+        assert(list.GetSize() == 3u);
+    }
+
+    // Строгая гарантия безопасности исключений при выделении узлов из пула
+    {
+        struct ThrowOnCopy {
+            ThrowOnCopy() = default;
+            explicit ThrowOnCopy(int& copy_counter) noexcept
+                : countdown_ptr(&copy_counter) {
+            }
+            ThrowOnCopy(const ThrowOnCopy& other)
+                : countdown_ptr(other.countdown_ptr)  //
+            {
+                if (countdown_ptr) {
+                    if (*countdown_ptr == 0) {
+                        throw std::bad_alloc();
+                    } else {
+                        --(*countdown_ptr);
+                    }
+                }
+            }
+            ThrowOnCopy& operator=(const ThrowOnCopy& rhs) = delete;
+            int* countdown_ptr = nullptr;
+        };
+
+        SingleLinkedList<ThrowOnCopy, PoolAllocator<ThrowOnCopy>> list;
+        list.PushFront(ThrowOnCopy{});
+        int copy_counter = 0;
+        try {
+            list.PushFront(ThrowOnCopy(copy_counter));
+            assert(false);
+        } catch (const std::bad_alloc&) {
+            assert(list.GetSize() == 1u);
+        }
+    }
+}
+
+// Эта функция проверяет перемещение списков и конструирование элементов на месте
+void Test7() {
+    using namespace std;
+
+    // Тип, который можно только перемещать
+    struct MoveOnly {
+        explicit MoveOnly(int v) noexcept
+            : value(v) {
+        }
+        MoveOnly(const MoveOnly&) = delete;
+        MoveOnly& operator=(const MoveOnly&) = delete;
+        MoveOnly(MoveOnly&& other) noexcept
+            : value(exchange(other.value, 0)) {
+        }
+        MoveOnly& operator=(MoveOnly&&) = delete;
+        int value = 0;
+    };
+
+    // Перемещение элементов в список
+    {
+        SingleLinkedList<string> list;
+        string value = "long string that does not fit into small buffer"s;
+        list.PushFront(move(value));
+        assert(value.empty());
+        string other = "another long string that does not fit into small buffer"s;
+        list.InsertAfter(list.cbegin(), move(other));
+        assert(other.empty());
+        assert(list.GetSize() == 2u);
+        assert((list == SingleLinkedList<string>{"long string that does not fit into small buffer"s,
+                                                 "another long string that does not fit into small buffer"s}));
+    }
+
+    // Конструирование элементов на месте
+    {
+        SingleLinkedList<MoveOnly> list;
+        MoveOnly& front = list.EmplaceFront(1);
+        assert(front.value == 1);
+        const auto pos = list.EmplaceAfter(list.cbegin(), 3);
+        assert(pos->value == 3);
+        const auto first = list.EmplaceAfter(list.cbefore_begin(), 0);
+        assert(first == list.begin());
+        list.EmplaceAfter(++list.cbegin(), 2);
+        assert(list.GetSize() == 4u);
+        int expected = 0;
+        for (const MoveOnly& item : list) {
+            assert(item.value == expected++);
+        }
+    }
+
+    // Вставка в начало через InsertAfter увеличивает размер ровно на единицу
+    {
+        SingleLinkedList<int> list{2, 3};
+        list.InsertAfter(list.cbefore_begin(), 1);
+        assert(list.GetSize() == 3u);
+        assert((list == SingleLinkedList<int>{1, 2, 3}));
+    }
+
+    // Перемещающий конструктор забирает узлы
+    {
+        SingleLinkedList<int> source{1, 2, 3};
+        const auto old_begin = source.begin();
+        SingleLinkedList<int> target(move(source));
+        assert(target.begin() == old_begin);
+        assert(target.GetSize() == 3u);
+        assert(source.IsEmpty());
+        assert(source.begin() == source.end());
+        source.PushFront(4);
+        assert(source.GetSize() == 1u);
+    }
+
+    // Перемещающее присваивание
+    {
+        SingleLinkedList<int> source{1, 2, 3};
+        const auto old_begin = source.begin();
+        SingleLinkedList<int> target{4, 5};
+        target = move(source);
+        assert(target.begin() == old_begin);
+        assert((target == SingleLinkedList<int>{1, 2, 3}));
+        assert(target.GetSize() == 3u);
+        assert(source.IsEmpty());
+
+        static_assert(is_nothrow_move_constructible_v<SingleLinkedList<string>>);
+        static_assert(is_nothrow_move_assignable_v<SingleLinkedList<string>>);
+    }
+}
+
+// Эта функция проверяет создание списка из диапазона и метод Assign
+void Test8() {
+    using namespace std;
+
+    // Создание списка из диапазона итераторов сохраняет порядок элементов
+    {
+        const vector<string> source{"one"s, "two"s, "three"s};
+        SingleLinkedList<string> list(source.begin(), source.end());
+        assert(list.GetSize() == 3u);
+        assert(equal(list.begin(), list.end(), source.begin(), source.end()));
+
+        SingleLinkedList<string> empty(source.end(), source.end());
+        assert(empty.IsEmpty());
+    }
+
+    // Копирование списка создаёт ровно N узлов без промежуточного буфера
+    {
+        auto& counters = AllocationCounters::Instance();
+        counters = {};
+        SingleLinkedList<int, CountingAllocator<int>> list{1, 2, 3, 4};
+        assert(counters.allocations == 4);
+        SingleLinkedList<int, CountingAllocator<int>> copy(list);
+        assert(counters.allocations == 8);
+        assert(copy == list);
+        assert(copy.GetSize() == 4u);
+    }
+
+    // Assign перезаписывает существующие узлы и добавляет или удаляет недостающие
+    {
+        SingleLinkedList<int> list{1, 2, 3};
+        const auto old_begin = list.begin();
+
+        list.Assign({4, 5});
+        assert((list == SingleLinkedList<int>{4, 5}));
+        assert(list.GetSize() == 2u);
+        assert(list.begin() == old_begin);
+
+        const vector<int> longer{6, 7, 8, 9};
+        list.Assign(longer.begin(), longer.end());
+        assert((list == SingleLinkedList<int>{6, 7, 8, 9}));
+        assert(list.GetSize() == 4u);
+        assert(list.begin() == old_begin);
+
+        list.Assign({});
+        assert(list.IsEmpty());
+        assert(list.begin() == list.end());
+    }
+
+    // При исключении во время создания списка из диапазона созданные узлы удаляются
+    {
+        struct ThrowOnCopy {
+            ThrowOnCopy() = default;
+            explicit ThrowOnCopy(int& copy_counter) noexcept
+                : countdown_ptr(&copy_counter) {
+            }
+            ThrowOnCopy(const ThrowOnCopy& other)
+                : countdown_ptr(other.countdown_ptr)  //
+            {
+                if (countdown_ptr) {
+                    if (*countdown_ptr == 0) {
+                        throw std::bad_alloc();
+                    } else {
+                        --(*countdown_ptr);
+                    }
+                }
+            }
+            ThrowOnCopy& operator=(const ThrowOnCopy& rhs) = delete;
+            int* countdown_ptr = nullptr;
+        };
+
+        auto& counters = AllocationCounters::Instance();
+        counters = {};
+        int copy_counter = 2;
+        vector<ThrowOnCopy> source(4);
+        for (auto& item : source) {
+            item.countdown_ptr = &copy_counter;
+        }
+        try {
+            SingleLinkedList<ThrowOnCopy, CountingAllocator<ThrowOnCopy>> list(source.begin(), source.end());
+            assert(false);
+        } catch (const std::bad_alloc&) {
+            assert(counters.allocations == 3);
+            assert(counters.deallocations == 3);
+        }
+    }
+}
+
+// Эта функция проверяет работу SingleLinkedList с отслеживанием последнего элемента
+void Test9() {
+    using namespace std;
+    using Queue = SingleLinkedList<int, allocator<int>, TailTracking>;
+
+    // Список без отслеживания хвоста не тратит на него память
+    static_assert(sizeof(SingleLinkedList<int>) == 2 * sizeof(void*));
+    static_assert(sizeof(Queue) == 3 * sizeof(void*));
+
+    // Добавление в конец
+    {
+        Queue queue;
+        queue.PushBack(1);
+        assert(queue.Back() == 1);
+        queue.PushBack(2);
+        queue.EmplaceBack(3);
+        queue.PushFront(0);
+        assert(queue.Back() == 3);
+        assert(queue.GetSize() == 4u);
+        assert((queue == Queue{0, 1, 2, 3}));
+
+        // Очередь FIFO
+        queue.PopFront();
+        queue.PopFront();
+        queue.PopFront();
+        assert(queue.Back() == 3);
+        queue.PopFront();
+        assert(queue.IsEmpty());
+        queue.PushBack(4);
+        assert(queue.Back() == 4);
+        assert((queue == Queue{4}));
+    }
+
+    // Хвост поддерживается при вставке и удалении после произвольной позиции
+    {
+        Queue queue{1, 2, 3};
+        assert(queue.Back() == 3);
+        queue.InsertAfter(++(++queue.cbegin()), 4);
+        assert(queue.Back() == 4);
+        queue.InsertAfter(queue.cbegin(), 10);
+        assert(queue.Back() == 4);
+        queue.EraseAfter(++(++(++queue.cbegin())));
+        assert(queue.Back() == 3);
+        assert((queue == Queue{1, 10, 2, 3}));
+        queue.PushBack(5);
+        assert((queue == Queue{1, 10, 2, 3, 5}));
+
+        Queue single{1};
+        single.EraseAfter(single.cbefore_begin());
+        single.PushBack(2);
+        assert((single == Queue{2}));
+        assert(single.Back() == 2);
+
+        queue.Assign({7, 8});
+        assert(queue.Back() == 8);
+        queue.Assign({9, 10, 11});
+        assert(queue.Back() == 11);
+        queue.Clear();
+        queue.EmplaceFront(12);
+        assert(queue.Back() == 12);
+    }
+
+    // Хвост переносится при обмене, копировании и перемещении
+    {
+        Queue first{1, 2};
+        Queue second{3};
+        first.swap(second);
+        assert(first.Back() == 3);
+        assert(second.Back() == 2);
+
+        Queue copy(second);
+        copy.PushBack(4);
+        assert((copy == Queue{1, 2, 4}));
+        assert(second.Back() == 2);
+
+        first = copy;
+        first.PushBack(5);
+        assert((first == Queue{1, 2, 4, 5}));
+
+        Queue moved(move(first));
+        moved.PushBack(6);
+        assert(moved.Back() == 6);
+        first.PushBack(7);
+        assert((first == Queue{7}));
+    }
+
+    // Конкатенация списков за O(1)
+    {
+        Queue first{1, 2};
+        Queue second{3, 4};
+        const auto second_begin = second.begin();
+        first.SpliceBack(second);
+        assert((first == Queue{1, 2, 3, 4}));
+        assert(first.GetSize() == 4u);
+        assert(first.Back() == 4);
+        assert(++(++first.begin()) == second_begin);
+        assert(second.IsEmpty());
+
+        second.PushBack(5);
+        first.SpliceBack(move(second));
+        first.SpliceBack(Queue{});
+        assert((first == Queue{1, 2, 3, 4, 5}));
+
+        Queue empty;
+        empty.SpliceBack(first);
+        assert(empty.Back() == 5);
+        assert(empty.GetSize() == 5u);
+    }
+}
+
+// Эта функция проверяет перенос узлов между списками и групповые вставку и удаление
+void Test10() {
+    using namespace std;
+    using IntList = SingleLinkedList<int>;
+    using Queue = SingleLinkedList<int, allocator<int>, TailTracking>;
+
+    // Вставка диапазона и нескольких копий элемента
+    {
+        IntList list{1, 5};
+        const vector<int> values{2, 3, 4};
+        auto last_inserted = list.InsertAfter(list.cbegin(), values.begin(), values.end());
+        assert(*last_inserted == 4);
+        assert((list == IntList{1, 2, 3, 4, 5}));
+        assert(list.GetSize() == 5u);
+
+        last_inserted = list.InsertAfter(list.cbefore_begin(), 2, 0);
+        assert(*last_inserted == 0);
+        assert((list == IntList{0, 0, 1, 2, 3, 4, 5}));
+        assert(list.GetSize() == 7u);
+
+        assert(list.InsertAfter(list.cbegin(), values.end(), values.end()) == list.begin());
+        assert(list.InsertAfter(list.cbegin(), 0, 7) == list.begin());
+
+        Queue queue{1};
+        queue.InsertAfter(queue.cbegin(), {2, 3});
+        assert(queue.Back() == 3);
+        queue.PushBack(4);
+        assert((queue == Queue{1, 2, 3, 4}));
+    }
+
+    // Вставка диапазона обеспечивает строгую гарантию безопасности исключений
+    {
+        struct ThrowOnCopy {
+            ThrowOnCopy() = default;
+            ThrowOnCopy(const ThrowOnCopy& other)
+                : countdown_ptr(other.countdown_ptr)  //
+            {
+                if (countdown_ptr) {
+                    if (*countdown_ptr == 0) {
+                        throw std::bad_alloc();
+                    } else {
+                        --(*countdown_ptr);
+                    }
+                }
+            }
+            ThrowOnCopy& operator=(const ThrowOnCopy& rhs) = delete;
+            int* countdown_ptr = nullptr;
+        };
+
+        SingleLinkedList<ThrowOnCopy> list{ThrowOnCopy{}, ThrowOnCopy{}};
+        const auto old_second = ++list.cbegin();
+        int copy_counter = 2;
+        ThrowOnCopy thrower;
+        thrower.countdown_ptr = &copy_counter;
+        try {
+            list.InsertAfter(list.cbegin(), 5, thrower);
+            assert(false);
+        } catch (const std::bad_alloc&) {
+            assert(list.GetSize() == 2u);
+            assert(++list.cbegin() == old_second);
+            assert(++(++list.cbegin()) == list.cend());
+        }
+    }
+
+    // Удаление интервала элементов
+    {
+        IntList list{1, 2, 3, 4, 5};
+        auto first = list.cbegin();
+        auto last = first;
+        advance(last, 3);
+        const auto result = list.EraseAfter(first, last);
+        assert(result == last);
+        assert((list == IntList{1, 4, 5}));
+        assert(list.GetSize() == 3u);
+
+        assert(list.EraseAfter(list.cbegin(), ++list.cbegin()) == ++list.begin());
+        assert(list.GetSize() == 3u);
+
+        list.EraseAfter(list.cbefore_begin(), list.cend());
+        assert(list.IsEmpty());
+        assert(list.begin() == list.end());
+
+        Queue queue{1, 2, 3};
+        queue.EraseAfter(queue.cbegin(), queue.cend());
+        assert(queue.Back() == 1);
+        queue.PushBack(4);
+        assert((queue == Queue{1, 4}));
+    }
+
+    // Перенос всех элементов другого списка
+    {
+        IntList target{1, 5};
+        IntList source{2, 3, 4};
+        const auto source_begin = source.begin();
+        target.SpliceAfter(target.cbegin(), source);
+        assert((target == IntList{1, 2, 3, 4, 5}));
+        assert(target.GetSize() == 5u);
+        assert(++target.begin() == source_begin);
+        assert(source.IsEmpty());
+        assert(source.begin() == source.end());
+
+        target.SpliceAfter(target.cbegin(), IntList{});
+        assert(target.GetSize() == 5u);
+
+        Queue queue{1};
+        Queue other{2, 3};
+        queue.SpliceAfter(queue.cbegin(), other);
+        assert(queue.Back() == 3);
+        other.PushBack(4);
+        queue.SpliceAfter(queue.cbefore_begin(), move(other));
+        assert((queue == Queue{4, 1, 2, 3}));
+        assert(queue.Back() == 3);
+    }
+
+    // Перенос одного элемента
+    {
+        Queue target{1, 3};
+        Queue source{2, 4};
+        target.SpliceAfter(target.cbegin(), source, source.cbefore_begin());
+        assert((target == Queue{1, 2, 3}));
+        assert((source == Queue{4}));
+        assert(target.GetSize() == 3u);
+        assert(source.GetSize() == 1u);
+
+        target.SpliceAfter(++(++target.cbegin()), source, source.cbefore_begin());
+        assert((target == Queue{1, 2, 3, 4}));
+        assert(target.Back() == 4);
+        assert(source.IsEmpty());
+        source.PushBack(5);
+        assert(source.Back() == 5);
+
+        // Перенос внутри одного списка: последний элемент становится первым
+        target.SpliceAfter(target.cbefore_begin(), target, ++(++target.cbegin()));
+        assert((target == Queue{4, 1, 2, 3}));
+        assert(target.GetSize() == 4u);
+        assert(target.Back() == 3);
+    }
+
+    // Перенос интервала элементов без копирования и выделения памяти
+    {
+        auto& counters = AllocationCounters::Instance();
+        using CountingList = SingleLinkedList<string, CountingAllocator<string>, TailTracking>;
+        CountingList target{"a"s, "e"s};
+        CountingList source{"x"s, "b"s, "c"s, "d"s, "y"s};
+        const int allocations = counters.allocations;
+
+        auto last = source.cbegin();
+        advance(last, 4);
+        target.SpliceAfter(target.cbegin(), source, source.cbegin(), last);
+        assert(counters.allocations == allocations);
+        assert((target == CountingList{"a"s, "b"s, "c"s, "d"s, "e"s}));
+        assert((source == CountingList{"x"s, "y"s}));
+        assert(target.GetSize() == 5u);
+        assert(source.GetSize() == 2u);
+
+        target.SpliceAfter(target.cbefore_begin(), source, source.cbegin(), source.cend());
+        assert((target == CountingList{"y"s, "a"s, "b"s, "c"s, "d"s, "e"s}));
+        assert(source.Back() == "x"s);
+        assert(target.Back() == "e"s);
+    }
+}
+
+// Эта функция проверяет сортировку, слияние и фильтрацию списка
+void Test11() {
+    using namespace std;
+    using IntList = SingleLinkedList<int>;
+    using Queue = SingleLinkedList<int, allocator<int>, TailTracking>;
+
+    // Сортировка переставляет узлы, не выделяя память
+    {
+        auto& counters = AllocationCounters::Instance();
+        SingleLinkedList<int, CountingAllocator<int>> list{5, 3, 9, 1, 7, 3, 8, 2, 6, 4, 0};
+        const int allocations = counters.allocations;
+        list.Sort();
+        assert(counters.allocations == allocations);
+        assert((list == SingleLinkedList<int, CountingAllocator<int>>{0, 1, 2, 3, 3, 4, 5, 6, 7, 8, 9}));
+        assert(list.GetSize() == 11u);
+
+        list.Sort(greater<>{});
+        assert((list == SingleLinkedList<int, CountingAllocator<int>>{9, 8, 7, 6, 5, 4, 3, 3, 2, 1, 0}));
+
+        IntList empty;
+        empty.Sort();
+        assert(empty.IsEmpty());
+    }
+
+    // Сортировка устойчива и поддерживает указатель на последний элемент
+    {
+        SingleLinkedList<pair<int, int>, allocator<pair<int, int>>, TailTracking> list;
+        vector<pair<int, int>> expected;
+        for (int i = 0; i < 1000; ++i) {
+            list.PushBack({(i * 7919) % 13, i});
+            expected.push_back({(i * 7919) % 13, i});
+        }
+        const auto by_key = [](const pair<int, int>& lhs, const pair<int, int>& rhs) {
+            return lhs.first < rhs.first;
+        };
+        list.Sort(by_key);
+        stable_sort(expected.begin(), expected.end(), by_key);
+        assert(equal(list.begin(), list.end(), expected.begin(), expected.end()));
+        assert(list.Back() == expected.back());
+        list.PushBack({100, 100});
+        assert(list.GetSize() == 1001u);
+    }
+
+    // Исключение в компараторе не приводит к потере элементов
+    {
+        IntList list{5, 4, 3, 2, 1, 0, 9, 8, 7, 6};
+        int comparisons = 0;
+        try {
+            list.Sort([&comparisons](int lhs, int rhs) {
+                if (++comparisons == 12) {
+                    throw runtime_error("comparison failed");
+                }
+                return lhs < rhs;
+            });
+            assert(false);
+        } catch (const runtime_error&) {
+            vector<int> values(list.begin(), list.end());
+            sort(values.begin(), values.end());
+            assert((values == vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+            assert(list.GetSize() == 10u);
+        }
+    }
+
+    // Слияние отсортированных списков
+    {
+        Queue first{1, 3, 5, 7};
+        Queue second{0, 2, 3, 8, 9};
+        const auto second_begin = second.begin();
+        first.Merge(second);
+        assert((first == Queue{0, 1, 2, 3, 3, 5, 7, 8, 9}));
+        assert(first.begin() == second_begin);
+        assert(first.GetSize() == 9u);
+        assert(first.Back() == 9);
+        assert(second.IsEmpty());
+
+        first.Merge(Queue{10});
+        assert(first.Back() == 10);
+        second.PushBack(1);
+        assert((second == Queue{1}));
+
+        IntList descending{5, 3, 1};
+        descending.Merge(IntList{4, 2}, greater<>{});
+        assert((descending == IntList{5, 4, 3, 2, 1}));
+    }
+
+    // Удаление подряд идущих дубликатов
+    {
+        Queue list{1, 1, 2, 2, 2, 3, 1, 4, 4};
+        assert(list.Unique() == 4u);
+        assert((list == Queue{1, 2, 3, 1, 4}));
+        assert(list.GetSize() == 5u);
+        assert(list.Back() == 4);
+
+        IntList close{1, 2, 3, 10, 11, 20};
+        assert(close.Unique([](int lhs, int rhs) {
+            return rhs - lhs <= 2;
+        }) == 3u);
+        assert((close == IntList{1, 10, 20}));
+
+        IntList empty;
+        assert(empty.Unique() == 0u);
+    }
+
+    // Удаление элементов по условию
+    {
+        Queue list{1, 2, 3, 4, 5, 6};
+        assert(list.RemoveIf([](int value) {
+            return value % 2 == 0;
+        }) == 3u);
+        assert((list == Queue{1, 3, 5}));
+        assert(list.GetSize() == 3u);
+        assert(list.Back() == 5);
+        list.PushBack(7);
+        assert((list == Queue{1, 3, 5, 7}));
+
+        // Значение может ссылаться на элемент самого списка
+        IntList numbers{2, 1, 2, 3, 2};
+        assert(numbers.Remove(*numbers.begin()) == 3u);
+        assert((numbers == IntList{1, 3}));
+
+        assert(numbers.RemoveIf([](int) {
+            return true;
+        }) == 2u);
+        assert(numbers.IsEmpty());
+        assert(numbers.begin() == numbers.end());
+    }
+}
+
+void Test12() {
+    using namespace std;
+    using StatsList = SingleLinkedList<int, allocator<int>, NoTailTracking, CollectListStatistics>;
+
+    // Без политики сбора статистики список не увеличивается в размере, а итераторы не ссылаются на статистику
+    static_assert(sizeof(SingleLinkedList<int>::Iterator) == sizeof(void*));
+    static_assert(sizeof(StatsList::Iterator) == sizeof(void*));
+    static_assert(sizeof(SingleLinkedList<int>) == sizeof(StatsList) - sizeof(ListStatistics));
+
+    // Счётчики выделений, размера и переходов между узлами
+    {
+        StatsList list{1, 2, 3};
+        list.SetStatisticsLabel("hot list");
+        ListStatisticsSnapshot stats = list.GetStatistics();
+        assert(stats.allocations == 3u);
+        assert(stats.deallocations == 0u);
+        assert(stats.peak_size == 3u);
+        assert(stats.bytes_held > 0u);
+
+        const size_t node_bytes = stats.bytes_held / 3;
+        // Переходы считают методы обхода списка, а не итераторы
+        const size_t steps = stats.traversal_steps;
+        int sum = 0;
+        for (int value : list) {
+            sum += value;
+        }
+        assert(sum == 6);
+        assert(list.GetStatistics().traversal_steps == steps);
+        assert(list.Accumulate(0) == 6);
+        list.ForEach([](int) {});
+        assert(list.GetStatistics().traversal_steps == steps + 6);
+        list.RemoveIf([](int value) {
+            return value > 3;
+        });
+        assert(list.GetStatistics().traversal_steps == steps + 9);
+
+        // Сравнение учитывает только элементы, пройденные до первого различия, в статистике обоих списков
+        {
+            const StatsList greater{1, 5, 3, 4};
+            const StatsList different{1, 9, 3};
+            assert(list.CompareTo(greater) < 0);
+            assert(list.GetStatistics().traversal_steps == steps + 11);
+            assert(greater.GetStatistics().traversal_steps == 2u);
+            assert(!list.IsEqualTo(different));
+            assert(list.GetStatistics().traversal_steps == steps + 13);
+            assert(different.GetStatistics().traversal_steps == 2u);
+            assert(list.IsEqualTo(StatsList{1, 2, 3}));
+            assert(list.GetStatistics().traversal_steps == steps + 16);
+        }
+
+        // Инкременты итераторов учитываются только при обходе через Counted()
+        const size_t increments = list.GetStatistics().iterator_increments;
+        int counted_sum = 0;
+        for (int value : list.Counted()) {
+            counted_sum += value;
+        }
+        assert(counted_sum == 6);
+        assert(list.GetStatistics().iterator_increments == increments + 3);
+        for (int& value : list.Counted()) {
+            value *= 10;
+        }
+        const StatsList& const_list = list;
+        assert(*max_element(const_list.Counted().begin(), const_list.Counted().end()) == 30);
+        assert(list.GetStatistics().iterator_increments == increments + 9);
+        assert(list.GetStatistics().traversal_steps == steps + 16);
+        for (int& value : list) {
+            value /= 10;
+        }
+        assert(list.GetStatistics().iterator_increments == increments + 9);
+
+        list.PopFront();
+        list.EraseAfter(list.cbegin());
+        list.PushFront(0);
+        stats = list.GetStatistics();
+        assert(stats.allocations == 4u);
+        assert(stats.deallocations == 2u);
+        assert(stats.peak_size == 3u);
+        assert(stats.bytes_held == 2 * node_bytes);
+
+        // Перенос узлов учитывается в размере обоих списков
+        StatsList other{7, 8, 9, 10};
+        list.SpliceAfter(list.cbefore_begin(), other);
+        assert(list.GetStatistics().peak_size == 6u);
+        assert(list.GetStatistics().bytes_held == 6 * node_bytes);
+        assert(other.GetStatistics().bytes_held == 0u);
+        assert(other.GetStatistics().peak_size == 4u);
+
+        list.Clear();
+        assert(list.GetStatistics().bytes_held == 0u);
+        assert(list.GetStatistics().deallocations == 8u);
+    }
+
+    // Реестр содержит статистику только существующих списков
+    {
+        const size_t registered = ListStatisticsRegistry::Instance().Collect().size();
+        {
+            StatsList cold{1};
+            StatsList hot;
+            hot.SetStatisticsLabel("hot");
+            for (int i = 0; i < 10; ++i) {
+                hot.PushFront(i);
+            }
+            StatsList moved(std::move(hot));
+            const vector<ListStatisticsSnapshot> snapshots = ListStatisticsRegistry::Instance().Collect();
+            assert(snapshots.size() == registered + 3);
+            assert(snapshots.front().label != nullptr && string(snapshots.front().label) == "hot");
+            assert(snapshots.front().allocations == 10u);
+
+            ostringstream out;
+            ListStatisticsRegistry::Instance().Dump(out);
+            assert(out.str().find("hot: allocations=10 deallocations=0") != string::npos);
+        }
+        assert(ListStatisticsRegistry::Instance().Collect().size() == registered);
+    }
+
+    // Итератор на узел, перешедший в другой список, остаётся пригодным после разрушения исходного списка
+    {
+        auto source = make_unique<StatsList>(initializer_list<int>{1, 2, 3});
+        StatsList::Iterator it = source->begin();
+        ++it;
+        StatsList tail = source->SplitAfter(source->cbegin());
+        source.reset();
+        assert(*it == 2);
+        ++it;
+        assert(*it == 3);
+        ++it;
+        assert(it == tail.end());
+    }
+}
+
+void Test13() {
+    using namespace std;
+    using ArenaList = SingleLinkedList<uint64_t, ArenaAllocator<uint64_t>>;
+
+    // Clear освобождает арену целиком, не обходя узлы
+    {
+        ArenaList list;
+        for (uint64_t i = 0; i < 10000; ++i) {
+            list.PushFront(i);
+        }
+        const NodeArena& arena = list.get_allocator().GetArena();
+        assert(arena.GetLiveCount() == 10000u);
+        assert(arena.GetChunkCount() > 1u);
+
+        list.Clear();
+        assert(list.IsEmpty());
+        assert(list.begin() == list.end());
+        assert(arena.GetLiveCount() == 0u);
+        assert(arena.GetChunkCount() == 0u);
+
+        // После очистки список и арена пригодны для работы
+        list.PushFront(1);
+        list.InsertAfter(list.cbegin(), 2);
+        assert((list == ArenaList{1, 2}));
+        assert(arena.GetLiveCount() == 2u);
+    }
+
+    // Копия списка получает собственную арену
+    {
+        ArenaList list{1, 2, 3};
+        ArenaList copy(list);
+        assert(copy.get_allocator() != list.get_allocator());
+        copy.Clear();
+        assert(copy.get_allocator().GetArena().GetChunkCount() == 0u);
+        assert((list == ArenaList{1, 2, 3}));
+    }
+
+    // Если арена содержит чужие узлы, Clear удаляет узлы по одному
+    {
+        ArenaList list{1, 2, 3};
+        ArenaList moved(std::move(list));
+        list.PushFront(10);
+        const NodeArena& arena = moved.get_allocator().GetArena();
+        assert(&arena == &list.get_allocator().GetArena());
+        moved.Clear();
+        assert(arena.GetLiveCount() == 1u);
+        assert(list.GetSize() == 1u && *list.begin() == 10);
+    }
+
+    // Нетривиально разрушаемые элементы удаляются по одному
+    {
+        SingleLinkedList<string, ArenaAllocator<string>> list{"a long string that needs heap memory", "b"};
+        list.Clear();
+        assert(list.IsEmpty());
+        assert(list.get_allocator().GetArena().GetChunkCount() > 0u);
+    }
+
+    // Статистика учитывает узлы, освобождённые вместе с ареной
+    {
+        SingleLinkedList<int, ArenaAllocator<int>, NoTailTracking, CollectListStatistics> list{1, 2, 3};
+        list.Clear();
+        assert(list.GetStatistics().deallocations == 3u);
+        assert(list.GetStatistics().bytes_held == 0u);
+    }
+
+    // ClearAsync передаёт память фоновому потоку
+    {
+        SingleLinkedList<uint64_t, ArenaAllocator<uint64_t>, TailTracking> list;
+        for (uint64_t i = 0; i < 10000; ++i) {
+            list.PushBack(i);
+        }
+        list.ClearAsync();
+        assert(list.IsEmpty());
+        assert(list.get_allocator().GetArena().GetChunkCount() == 0u);
+        list.PushBack(5);
+        assert(list.Back() == 5u);
+        ArenaReclaimer::Instance().Wait();
+
+        // Без арены ClearAsync выполняет обычный Clear
+        SingleLinkedList<int> plain{1, 2, 3};
+        plain.ClearAsync();
+        assert(plain.IsEmpty());
+    }
+}
+
+// Проверка обхода ForEach, ForEachChunked и Accumulate
+void Test14() {
+    using namespace std;
+
+    // Пустой список
+    {
+        const SingleLinkedList<int> empty;
+        int calls = 0;
+        empty.ForEach([&calls](int) {
+            ++calls;
+        });
+        empty.ForEachChunked([&calls](const int* const*, size_t) {
+            ++calls;
+        });
+        assert(calls == 0);
+        assert(empty.Accumulate(7) == 7);
+    }
+
+    // ForEach проходит элементы по порядку и возвращает функцию
+    {
+        SingleLinkedList<int> list{1, 2, 3, 4, 5};
+        vector<int> values;
+        list.ForEach([&values](int value) {
+            values.push_back(value);
+        });
+        assert((values == vector<int>{1, 2, 3, 4, 5}));
+
+        struct Counter {
+            void operator()(int& value) {
+                value *= 2;
+                ++count;
+            }
+            int count = 0;
+        };
+        assert(list.ForEach(Counter{}).count == 5);
+        assert((list == SingleLinkedList<int>{2, 4, 6, 8, 10}));
+
+        assert(list.Accumulate(0) == 30);
+        assert(list.Accumulate(1LL, multiplies<>{}) == 3840LL);
+        assert(list.Accumulate(string{}, [](string acc, int value) {
+            return acc + to_string(value);
+        }) == "246810");
+    }
+
+    // ForEachChunked разбивает список на порции, последняя может быть неполной
+    {
+        SingleLinkedList<int> list;
+        for (int i = 9; i >= 0; --i) {
+            list.PushFront(i);
+        }
+        vector<size_t> counts;
+        vector<int> values;
+        list.ForEachChunked<4>([&](int* const* items, size_t count) {
+            counts.push_back(count);
+            for (size_t i = 0; i < count; ++i) {
+                values.push_back(*items[i]);
+                ++*items[i];
+            }
+        });
+        assert((counts == vector<size_t>{4, 4, 2}));
+        assert((values == vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+        assert(*list.begin() == 1);
+
+        const auto& const_list = list;
+        counts.clear();
+        const_list.ForEachChunked<5>([&counts](const int* const*, size_t count) {
+            counts.push_back(count);
+        });
+        assert((counts == vector<size_t>{5, 5}));
+    }
+}
+
+// Проверка параллельных алгоритмов
+void Test15() {
+    using namespace std;
+    using IntList = SingleLinkedList<int, std::allocator<int>, TailTracking>;
+    constexpr size_t THREADS = 4;
+    constexpr int SIZE = 10000;
+
+    // Короткий список обрабатывается последовательно
+    {
+        SingleLinkedList<int> list{1, 2, 3};
+        list.ParallelForEach([](int& value) {
+            value *= 10;
+        }, THREADS);
+        assert((list == SingleLinkedList<int>{10, 20, 30}));
+        assert(list.ParallelReduce(0, plus<>{}, THREADS) == 60);
+        list.ParallelSort(greater<>{}, THREADS);
+        assert((list == SingleLinkedList<int>{30, 20, 10}));
+
+        const SingleLinkedList<int> empty;
+        assert(empty.ParallelReduce(5) == 5);
+    }
+
+    // Каждый элемент обрабатывается ровно один раз
+    {
+        IntList list;
+        for (int i = 0; i < SIZE; ++i) {
+            list.PushBack(i);
+        }
+        list.ParallelForEach([](int& value) {
+            value *= 2;
+        }, THREADS);
+        atomic<long long> sum{0};
+        std::as_const(list).ParallelForEach([&sum](const int& value) {
+            sum += value;
+        }, THREADS);
+        assert(sum == static_cast<long long>(SIZE) * (SIZE - 1));
+        assert(list.ParallelReduce(0LL, plus<>{}, THREADS) == sum);
+        assert(list.ParallelReduce(0LL, plus<>{}, 3) == sum);
+    }
+
+    // Участки объединяются по порядку, поэтому достаточно ассоциативности операции
+    {
+        SingleLinkedList<string> list;
+        for (int i = 0; i < SIZE; ++i) {
+            list.PushFront(string(1, static_cast<char>('a' + i % 26)));
+        }
+        assert(list.ParallelReduce(string{}, plus<>{}, THREADS) == list.Accumulate(string{}));
+    }
+
+    // Сортировка устойчива и совпадает с последовательной
+    {
+        struct Item {
+            int key = 0;
+            int index = 0;
+        };
+        auto by_key = [](const Item& lhs, const Item& rhs) {
+            return lhs.key < rhs.key;
+        };
+        SingleLinkedList<Item, std::allocator<Item>, TailTracking> list;
+        vector<Item> expected;
+        unsigned state = 1;
+        for (int i = 0; i < SIZE + 7; ++i) {
+            state = state * 1103515245u + 12345u;
+            const Item item{static_cast<int>(state >> 16) % 100, i};
+            list.PushBack(item);
+            expected.push_back(item);
+        }
+        stable_sort(expected.begin(), expected.end(), by_key);
+        list.ParallelSort(by_key, THREADS);
+        assert(list.GetSize() == expected.size());
+        assert(equal(list.begin(), list.end(), expected.begin(), [](const Item& lhs, const Item& rhs) {
+            return lhs.key == rhs.key && lhs.index == rhs.index;
+        }));
+        assert(list.Back().index == expected.back().index);
+        list.PushBack(Item{-1, -1});
+        assert(list.Back().key == -1);
+    }
+
+    // Исключение компаратора не приводит к потере элементов
+    {
+        IntList list;
+        for (int i = 0; i < SIZE; ++i) {
+            list.PushBack(SIZE - i);
+        }
+        atomic<int> comparisons{0};
+        bool exception_was_thrown = false;
+        try {
+            list.ParallelSort([&comparisons](int lhs, int rhs) {
+                if (++comparisons == 20000) {
+                    throw runtime_error("compare");
+                }
+                return lhs < rhs;
+            }, THREADS);
+        } catch (const runtime_error&) {
+            exception_was_thrown = true;
+        }
+        assert(exception_was_thrown);
+        assert(list.GetSize() == static_cast<size_t>(SIZE));
+        assert(distance(list.begin(), list.end()) == SIZE);
+        vector<int> values(list.begin(), list.end());
+        sort(values.begin(), values.end());
+        for (int i = 0; i < SIZE; ++i) {
+            assert(values[i] == i + 1);
+        }
+        list.PushBack(0);
+        assert(list.Back() == 0);
+    }
+
+    // Исключение из функции ParallelForEach передаётся вызывающему после завершения всех потоков
+    {
+        IntList list;
+        for (int i = 0; i < SIZE; ++i) {
+            list.PushBack(i);
+        }
+        atomic<int> visited{0};
+        bool exception_was_thrown = false;
+        try {
+            list.ParallelForEach([&visited](int value) {
+                ++visited;
+                if (value == SIZE - 1) {
+                    throw runtime_error("last");
+                }
+            }, THREADS);
+        } catch (const runtime_error&) {
+            exception_was_thrown = true;
+        }
+        assert(exception_was_thrown);
+        assert(visited == SIZE);
+    }
+}
+
+// Проверка двоичной сериализации
+void Test16() {
+    using namespace std;
+
+    struct Point {
+        int32_t x = 0;
+        double y = 0;
+    };
+
+    // Запись в поток и чтение из него
+    {
+        SingleLinkedList<int> list{1, 2, 3, 4, 5};
+        ostringstream out;
+        list.Serialize(out);
+        assert(out.str().size() == list.GetSerializedSize());
+        assert(list.GetSerializedSize() == sizeof(uint64_t) + 5 * sizeof(int));
+
+        istringstream in(out.str() + "tail");
+        const auto restored = SingleLinkedList<int>::Deserialize(in);
+        assert(restored == list);
+        // Байты после списка остаются в потоке
+        string rest;
+        in >> rest;
+        assert(rest == "tail");
+
+        ostringstream empty_out;
+        SingleLinkedList<int>{}.Serialize(empty_out);
+        istringstream empty_in(empty_out.str());
+        assert(SingleLinkedList<int>::Deserialize(empty_in).IsEmpty());
+    }
+
+    // Запись в буфер; список, не помещающийся в блок потока
+    {
+        SingleLinkedList<Point, std::allocator<Point>, TailTracking> list;
+        for (int i = 0; i < 1000; ++i) {
+            list.PushBack(Point{i, i / 2.0});
+        }
+        vector<unsigned char> buffer(list.GetSerializedSize());
+        assert(list.Serialize(buffer.data(), buffer.size()) == buffer.size());
+
+        bool exception_was_thrown = false;
+        try {
+            list.Serialize(buffer.data(), buffer.size() - 1);
+        } catch (const length_error&) {
+            exception_was_thrown = true;
+        }
+        assert(exception_was_thrown);
+
+        auto restored = decltype(list)::Deserialize(buffer.data(), buffer.size());
+        assert(restored.GetSize() == 1000u);
+        assert(restored.Back().x == 999 && restored.Back().y == 499.5);
+        int expected = 0;
+        for (const Point& point : restored) {
+            assert(point.x == expected++);
+        }
+
+        ostringstream out;
+        list.Serialize(out);
+        const string bytes = out.str();
+        assert(bytes.size() == buffer.size());
+        assert(equal(bytes.begin(), bytes.end(), buffer.begin(), [](char lhs, unsigned char rhs) {
+            return static_cast<unsigned char>(lhs) == rhs;
+        }));
+    }
+
+    // Данные закончились раньше времени
+    {
+        SingleLinkedList<int> list{1, 2, 3};
+        vector<unsigned char> buffer(list.GetSerializedSize());
+        list.Serialize(buffer.data(), buffer.size());
+        for (size_t size : {size_t{0}, size_t{5}, buffer.size() - 1}) {
+            bool exception_was_thrown = false;
+            try {
+                (void)SingleLinkedList<int>::Deserialize(buffer.data(), size);
+            } catch (const runtime_error&) {
+                exception_was_thrown = true;
+            }
+            assert(exception_was_thrown);
+
+            exception_was_thrown = false;
+            istringstream in(string(buffer.begin(), buffer.begin() + size));
+            try {
+                (void)SingleLinkedList<int>::Deserialize(in);
+            } catch (const runtime_error&) {
+                exception_was_thrown = true;
+            }
+            assert(exception_was_thrown);
+        }
+    }
+
+    // Потоковое чтение порциями любого размера дописывает элементы в конец списка
+    {
+        SingleLinkedList<int64_t> source;
+        for (int64_t i = 99; i >= 0; --i) {
+            source.PushFront(i * 3);
+        }
+        vector<unsigned char> buffer(source.GetSerializedSize());
+        source.Serialize(buffer.data(), buffer.size());
+        buffer.push_back(0xFF);
+
+        for (size_t portion : {size_t{1}, size_t{3}, size_t{8}, size_t{13}, buffer.size()}) {
+            SingleLinkedList<int64_t> list{-1};
+            SingleLinkedList<int64_t>::Deserializer deserializer(list);
+            size_t consumed = 0;
+            size_t previous_size = list.GetSize();
+            for (size_t offset = 0; offset < buffer.size(); offset += portion) {
+                consumed += deserializer.Feed(buffer.data() + offset, min(portion, buffer.size() - offset));
+                // Полностью полученные элементы сразу доступны
+                assert(list.GetSize() >= previous_size);
+                assert(static_cast<size_t>(distance(list.begin(), list.end())) == list.GetSize());
+                previous_size = list.GetSize();
+            }
+            assert(deserializer.IsComplete());
+            assert(deserializer.GetMissingBytes() == 0u);
+            assert(consumed == buffer.size() - 1);
+            assert(list.GetSize() == 101u);
+            assert(*list.begin() == -1);
+            assert(equal(source.begin(), source.end(), ++list.begin()));
+        }
+    }
+
+    // Узлы создаются аллокатором списка
+    {
+        using PooledList = SingleLinkedList<int, PoolAllocator<int>, NoTailTracking, CollectListStatistics>;
+        PooledList list{1, 2, 3};
+        ostringstream out;
+        list.Serialize(out);
+        istringstream in(out.str());
+        const PooledList restored = PooledList::Deserialize(in);
+        assert(restored == list);
+        assert(restored.GetStatistics().allocations == 3u);
+    }
+}
+
+namespace compare_test {
+
+// Подсчитывает вызовы операторов сравнения
+struct Counted {
+    bool operator<(const Counted& other) const {
+        ++less_calls;
+        return value < other.value;
+    }
+
+    bool operator==(const Counted& other) const {
+        ++equal_calls;
+        return value == other.value;
+    }
+
+    inline static int less_calls = 0;
+    inline static int equal_calls = 0;
+    int value = 0;
+};
+
+}  // namespace compare_test
+
+void Test17() {
+    using namespace std;
+    using compare_test::Counted;
+
+    // Compare возвращает знак лексикографического сравнения
+    {
+        const SingleLinkedList<int> empty;
+        const SingleLinkedList<int> list{1, 2, 3};
+        assert(empty.CompareTo(empty) == 0);
+        assert(empty.CompareTo(list) < 0);
+        assert(list.CompareTo(empty) > 0);
+        assert(list.CompareTo(SingleLinkedList<int>{1, 2, 3}) == 0);
+        assert(list.CompareTo(SingleLinkedList<int>{1, 2}) > 0);
+        assert(list.CompareTo(SingleLinkedList<int>{1, 2, 3, 0}) < 0);
+        assert(list.CompareTo(SingleLinkedList<int>{1, 3}) < 0);
+        assert(list.CompareTo(SingleLinkedList<int>{0, 9, 9, 9}) > 0);
+    }
+
+    // Отношения порядка обходят списки один раз
+    {
+        const SingleLinkedList<Counted> lhs{{1}, {2}, {3}};
+        const SingleLinkedList<Counted> rhs{{1}, {2}, {3}};
+        Counted::less_calls = 0;
+        Counted::equal_calls = 0;
+        assert(lhs <= rhs);
+        assert(Counted::less_calls == 6);
+        assert(Counted::equal_calls == 0);
+        Counted::less_calls = 0;
+        assert(lhs >= rhs);
+        assert(Counted::less_calls == 6);
+        assert(!(lhs < rhs) && !(lhs > rhs));
+    }
+
+    // Списки разной длины не равны, элементы при этом не сравниваются
+    {
+        const SingleLinkedList<Counted> lhs{{1}, {2}, {3}};
+        const SingleLinkedList<Counted> rhs{{1}, {2}};
+        Counted::equal_calls = 0;
+        assert(lhs != rhs);
+        assert(!(lhs == rhs));
+        assert(Counted::equal_calls == 0);
+        assert(lhs == lhs);
+        assert(Counted::equal_calls == 3);
+    }
+
+    // Сортировка вектора списков по содержимому
+    {
+        vector<SingleLinkedList<string>> lists{{"b"}, {"a", "c"}, {}, {"a"}, {"a", "b"}};
+        sort(lists.begin(), lists.end());
+        const vector<SingleLinkedList<string>> expected{{}, {"a"}, {"a", "b"}, {"a", "c"}, {"b"}};
+        assert(lists == expected);
+    }
+
+#if __cplusplus > 201703L
+    // Трёхстороннее сравнение
+    {
+        const SingleLinkedList<int> lhs{1, 2};
+        const SingleLinkedList<int> rhs{1, 3};
+        assert((lhs <=> rhs) == std::weak_ordering::less);
+        assert((rhs <=> lhs) == std::weak_ordering::greater);
+        assert((lhs <=> lhs) == std::weak_ordering::equivalent);
+    }
+#endif
+}
+
+void Test18() {
+    using namespace std;
+
+    // Пакетная вставка в начало сохраняет порядок диапазона
+    {
+        SingleLinkedList<int, std::allocator<int>, TailTracking> list{4, 5};
+        const vector<int> values{1, 2, 3};
+        list.PushFrontBatch(values.begin(), values.end());
+        assert((list == SingleLinkedList<int, std::allocator<int>, TailTracking>{1, 2, 3, 4, 5}));
+        assert(list.GetSize() == 5u);
+        assert(list.Back() == 5);
+        list.PushFrontBatch(values.end(), values.end());
+        assert(list.GetSize() == 5u);
+
+        SingleLinkedList<int, std::allocator<int>, TailTracking> empty;
+        empty.PushFrontBatch(values.begin(), values.end());
+        assert(empty.Back() == 3);
+        empty.PushBack(4);
+        assert((empty == SingleLinkedList<int, std::allocator<int>, TailTracking>{1, 2, 3, 4}));
+
+        // Однопроходный диапазон
+        SingleLinkedList<int> from_stream{9};
+        istringstream input("7 8");
+        from_stream.PushFrontBatch(istream_iterator<int>(input), istream_iterator<int>());
+        assert((from_stream == SingleLinkedList<int>{7, 8, 9}));
+    }
+
+    // Исключение при пакетной вставке не меняет список
+    {
+        struct ThrowOnCopy {
+            ThrowOnCopy() = default;
+            ThrowOnCopy(const ThrowOnCopy& other)
+                : throws(other.throws) {
+                if (throws) {
+                    throw runtime_error("copy");
+                }
+            }
+            bool throws = false;
+        };
+        vector<ThrowOnCopy> values(3);
+        values[2].throws = true;
+        SingleLinkedList<ThrowOnCopy> list;
+        list.EmplaceFront();
+        bool exception_was_thrown = false;
+        try {
+            list.PushFrontBatch(values.begin(), values.end());
+        } catch (const runtime_error&) {
+            exception_was_thrown = true;
+        }
+        assert(exception_was_thrown);
+        assert(list.GetSize() == 1u);
+    }
+
+    // Пакетное удаление из начала перемещает значения в выходной итератор
+    {
+        SingleLinkedList<string, std::allocator<string>, TailTracking> list{"a", "b", "c", "d"};
+        vector<string> out;
+        list.PopFrontN(2, back_inserter(out));
+        assert((out == vector<string>{"a", "b"}));
+        assert((list == SingleLinkedList<string, std::allocator<string>, TailTracking>{"c", "d"}));
+        assert(list.Back() == "d");
+
+        list.PopFrontN(0, back_inserter(out));
+        assert(out.size() == 2u && list.GetSize() == 2u);
+
+        // Запрошено больше элементов, чем есть в списке
+        string buffer[3];
+        string* end = list.PopFrontN(10, buffer);
+        assert(end == buffer + 2);
+        assert(buffer[0] == "c" && buffer[1] == "d");
+        assert(list.IsEmpty());
+        assert(list.begin() == list.end());
+        list.PushBack("e");
+        assert(list.Back() == "e" && list.GetSize() == 1u);
+    }
+
+    // Если запись в выходной итератор выбросит исключение, удаляются только перемещённые элементы
+    {
+        struct ThrowingOutput {
+            ThrowingOutput& operator*() {
+                return *this;
+            }
+            ThrowingOutput& operator++() {
+                return *this;
+            }
+            ThrowingOutput& operator=(int value) {
+                if (value == 3) {
+                    throw runtime_error("output");
+                }
+                ++*written;
+                return *this;
+            }
+            int* written;
+        };
+        SingleLinkedList<int, std::allocator<int>, TailTracking> list{1, 2, 3, 4};
+        int written = 0;
+        bool exception_was_thrown = false;
+        try {
+            list.PopFrontN(4, ThrowingOutput{&written});
+        } catch (const runtime_error&) {
+            exception_was_thrown = true;
+        }
+        assert(exception_was_thrown);
+        assert(written == 2);
+        assert((list == SingleLinkedList<int, std::allocator<int>, TailTracking>{3, 4}));
+        assert(list.Back() == 4);
+    }
+}
+
+// Эта функция проверяет запас узлов при политике NodeReserve
+void Test19() {
+    using namespace std;
+    using ReservedList = SingleLinkedList<int, CountingAllocator<int>, TailTracking, NoListStatistics, NodeReserve>;
+    static_assert(sizeof(SingleLinkedList<int, std::allocator<int>, NoTailTracking, NoListStatistics, NodeReserve>)
+                  == sizeof(SingleLinkedList<int>) + 3 * sizeof(size_t));
+
+    auto& counters = AllocationCounters::Instance();
+
+    // После Reserve вставки и удаления не обращаются к аллокатору
+    {
+        counters = {};
+        {
+            ReservedList list;
+            assert(list.GetCapacity() == 0u);
+            list.Reserve(4);
+            assert(list.GetCapacity() == 4u);
+            assert(counters.allocations == 4);
+
+            list.PushFront(2);
+            list.InsertAfter(list.cbegin(), 3);
+            list.PushBack(4);
+            list.PushFront(1);
+            assert(list.GetCapacity() == 4u);
+            assert(counters.allocations == 4);
+
+            list.PopFront();
+            list.EraseAfter(list.cbegin());
+            assert(counters.deallocations == 0);
+            assert(list.GetCapacity() == 4u);
+
+            list.Clear();
+            assert(list.IsEmpty());
+            assert(counters.deallocations == 0);
+            assert(list.GetCapacity() == 4u);
+
+            const vector<int> values{1, 2, 3, 4};
+            list.PushFrontBatch(values.begin(), values.end());
+            assert(counters.allocations == 4);
+            assert(list.Back() == 4);
+
+            // Сверх запаса узлы выделяются и освобождаются как обычно
+            list.PushFront(0);
+            assert(counters.allocations == 5);
+            assert(list.GetCapacity() == 5u);
+            list.Clear();
+            assert(counters.deallocations == 1);
+            assert(list.GetCapacity() == 4u);
+
+            // Повторный Reserve выделяет только недостающие узлы
+            list.PushFront(1);
+            list.Reserve(2);
+            assert(counters.allocations == 5);
+            list.Reserve(6);
+            assert(counters.allocations == 7);
+            assert(list.GetCapacity() == 6u);
+        }
+        assert(counters.allocations == counters.deallocations);
+    }
+
+    // ShrinkToFit возвращает запас аллокатору
+    {
+        counters = {};
+        ReservedList list{1, 2};
+        list.Reserve(10);
+        assert(counters.allocations == 10);
+        list.ShrinkToFit();
+        assert(counters.deallocations == 8);
+        assert(list.GetCapacity() == 2u);
+        list.PopFront();
+        assert(counters.deallocations == 9);
+        assert(list.GetCapacity() == 1u);
+    }
+
+    // Запас не копируется и не переносится, но обменивается
+    {
+        ReservedList first;
+        first.Reserve(3);
+        ReservedList second{1};
+        const ReservedList copy(first);
+        assert(copy.GetCapacity() == 0u);
+        ReservedList moved(std::move(first));
+        assert(moved.GetCapacity() == 0u);
+        assert(first.GetCapacity() == 3u);
+        swap(first, second);
+        assert(first.GetCapacity() == 1u);
+        assert(second.GetCapacity() == 3u);
+        second = copy;
+        assert(second.GetCapacity() == 3u);
+        second = std::move(moved);
+        assert(second.GetCapacity() == 3u);
+    }
+
+    // Если конструктор элемента выбросит исключение, узел вернётся в запас
+    {
+        struct ThrowOnCopy {
+            ThrowOnCopy() = default;
+            ThrowOnCopy(const ThrowOnCopy&) {
+                throw runtime_error("copy");
+            }
+        };
+        SingleLinkedList<ThrowOnCopy, std::allocator<ThrowOnCopy>, NoTailTracking, NoListStatistics, NodeReserve> list;
+        list.Reserve(1);
+        const ThrowOnCopy value;
+        bool exception_was_thrown = false;
+        try {
+            list.PushFront(value);
+        } catch (const runtime_error&) {
+            exception_was_thrown = true;
+        }
+        assert(exception_was_thrown);
+        assert(list.IsEmpty());
+        assert(list.GetCapacity() == 1u);
+        list.EmplaceFront();
+        assert(list.GetCapacity() == 1u);
+    }
+
+    // Освобождение арены целиком не забирает узлы запаса
+    {
+        SingleLinkedList<int, ArenaAllocator<int>, NoTailTracking, NoListStatistics, NodeReserve> list;
+        list.Reserve(3);
+        list.PushFront(1);
+        list.PushFront(2);
+        list.Clear();
+        assert(list.GetCapacity() == 3u);
+        list.PushFront(3);
+        assert(*list.begin() == 3);
+    }
+}
+
+void Test20() {
+#if __cplusplus > 201703L
+    using namespace std;
+    using TrackedList = SingleLinkedList<int, std::allocator<int>, TailTracking>;
+
+    static_assert(forward_iterator<SingleLinkedList<int>::Iterator>);
+    static_assert(forward_iterator<SingleLinkedList<int>::ConstIterator>);
+    static_assert(sentinel_for<default_sentinel_t, SingleLinkedList<int>::Iterator>);
+    static_assert(ranges::forward_range<SingleLinkedList<int>>);
+    static_assert(ranges::forward_range<const SingleLinkedList<int>>);
+    static_assert(ranges::common_range<SingleLinkedList<string>>);
+    static_assert(ranges::forward_range<SingleLinkedList<int, std::allocator<int>, TailTracking, CollectListStatistics>>);
+    using StatsList = SingleLinkedList<int, std::allocator<int>, NoTailTracking, CollectListStatistics>;
+    static_assert(ranges::view<StatsList::CountedView> && ranges::forward_range<StatsList::ConstCountedView>);
+    static_assert(ranges::forward_range<decltype(declval<SingleLinkedList<int>&>() | views::filter([](int) {
+        return true;
+    }))>);
+
+    // Обход до std::default_sentinel и алгоритмы std::ranges
+    {
+        SingleLinkedList<int> list{3, 1, 4, 1, 5};
+        int sum = 0;
+        for (auto it = list.cbegin(); it != default_sentinel; ++it) {
+            sum += *it;
+        }
+        assert(sum == 14);
+        assert(SingleLinkedList<int>{}.begin() == default_sentinel);
+        assert(ranges::count(list, 1) == 2);
+        assert(*ranges::find(list, 4) == 4);
+        assert(ranges::distance(list) == 5);
+    }
+
+    // Представления над списком ничего не копируют: элементы изменяются на месте
+    {
+        SingleLinkedList<int> list{1, 2, 3, 4};
+        for (int& value : list | views::filter([](int value) {
+                              return value % 2 == 0;
+                          })) {
+            value *= 10;
+        }
+        assert((list == SingleLinkedList<int>{1, 20, 3, 40}));
+    }
+
+    // Сборка конвейера в список за один проход с выводом типа элементов
+    {
+        const SingleLinkedList<int> source{1, 2, 3, 4, 5, 6};
+        auto result = source
+            | views::filter([](int value) {
+                  return value % 2 == 0;
+              })
+            | views::transform([](int value) {
+                  return to_string(value * value);
+              })
+            | ToList<SingleLinkedList>();
+        static_assert(is_same_v<decltype(result), SingleLinkedList<string>>);
+        assert((result == SingleLinkedList<string>{"4", "16", "36"}));
+        assert(source.GetSize() == 6u);
+
+        const auto empty = source | views::filter([](int value) {
+                               return value > 6;
+                           }) | ToList<SingleLinkedList>();
+        assert(empty.IsEmpty());
+    }
+
+    // Явный тип списка: хвост и размер обновляются после сборки
+    {
+        const vector<int> values{5, 6, 7};
+        auto list = values | views::reverse | ToList<TrackedList>();
+        assert(list.GetSize() == 3u);
+        assert(*list.begin() == 7 && list.Back() == 5);
+        list.PushBack(4);
+        assert((list == TrackedList{7, 6, 5, 4}));
+
+        const auto copy = TrackedList::FromRange(list);
+        assert(copy == list);
+    }
+
+    // Диапазоны, у которых страж имеет другой тип, в том числе однопроходные
+    {
+        const auto first_five = views::iota(0) | views::take_while([](int value) {
+                                    return value < 5;
+                                });
+        static_assert(!ranges::common_range<decltype(first_five)>);
+        assert((first_five | ToList<SingleLinkedList<int>>()) == (SingleLinkedList<int>{0, 1, 2, 3, 4}));
+
+        istringstream input("7 8 9");
+        const auto from_stream = views::istream<int>(input) | ToList<SingleLinkedList>();
+        assert((from_stream == SingleLinkedList<int>{7, 8, 9}));
+
+        // Учитываемый обход через Counted() работает в конвейерах диапазонов
+        const StatsList counted{1, 2, 3, 4};
+        const auto evens = counted.Counted() | views::filter([](int value) {
+                               return value % 2 == 0;
+                           })
+            | ToList<SingleLinkedList>();
+        assert((evens == SingleLinkedList<int>{2, 4}));
+        assert(counted.GetStatistics().iterator_increments == 4u);
+    }
+
+    // Исключение при создании элемента не оставляет созданных узлов
+    {
+        const SingleLinkedList<int> source{1, 2, 3};
+        bool exception_was_thrown = false;
+        try {
+            [[maybe_unused]] const auto list = source | views::transform([](int value) {
+                                                   if (value == 3) {
+                                                       throw runtime_error("transform");
+                                                   }
+                                                   return value;
+                                               })
+                | ToList<SingleLinkedList>();
+        } catch (const runtime_error&) {
+            exception_was_thrown = true;
+        }
+        assert(exception_was_thrown);
+    }
+#endif
+}
+
+// Эта функция проверяет кэши узлов потоков перед общим пулом
+void Test21() {
+    using namespace std;
+    // Размер и выравнивание, которые не используются в других тестах: у блоков свой пул
+    struct alignas(128) Block {
+        int value = 0;
+    };
+    using Cache = NodeCache<sizeof(Block), alignof(Block)>;
+    using Pool = NodePool<sizeof(Block), alignof(Block)>;
+    PoolAllocator<Block> alloc;
+
+    // Кэш пополняется пакетом и хранит ограниченное число блоков
+    thread([&alloc] {
+        assert(Cache::GetCachedCount() == 0u);
+        Block* first = alloc.allocate(1);
+        assert(Cache::GetCachedCount() == Cache::BATCH_SIZE - 1);
+        alloc.deallocate(first, 1);
+        assert(Cache::GetCachedCount() == Cache::BATCH_SIZE);
+
+        vector<Block*> blocks;
+        for (int i = 0; i < 1000; ++i) {
+            blocks.push_back(alloc.allocate(1));
+        }
+        for (Block* block : blocks) {
+            alloc.deallocate(block, 1);
+            assert(Cache::GetCachedCount() <= Cache::MAX_CACHED_BLOCKS);
+        }
+        assert(Cache::GetCachedCount() > 0u);
+        Cache::Release();
+        assert(Cache::GetCachedCount() == 0u);
+    }).join();
+
+    // При завершении потока блоки из его кэша возвращаются в пул
+    {
+        thread([&alloc] {
+            vector<Block*> blocks;
+            for (int i = 0; i < 1000; ++i) {
+                blocks.push_back(alloc.allocate(1));
+            }
+            for (Block* block : blocks) {
+                alloc.deallocate(block, 1);
+            }
+        }).join();
+        const size_t capacity = Pool::Instance().GetCapacity();
+        assert(capacity >= 1000u);
+
+        vector<Block*> blocks;
+        for (int i = 0; i < 1000; ++i) {
+            blocks.push_back(alloc.allocate(1));
+        }
+        assert(Pool::Instance().GetCapacity() == capacity);
+        for (Block* block : blocks) {
+            alloc.deallocate(block, 1);
+        }
+        Cache::Release();
+    }
+
+    // Узлы, созданные в одном потоке, освобождаются в другом,
+    // а потоки одновременно работают со своими списками
+    {
+        using PooledList = SingleLinkedList<int, PoolAllocator<int>>;
+        constexpr int THREAD_COUNT = 4;
+        constexpr int ITERATIONS = 200;
+        vector<PooledList> produced(THREAD_COUNT);
+        vector<thread> threads;
+        for (int t = 0; t < THREAD_COUNT; ++t) {
+            threads.emplace_back([&produced, t] {
+                PooledList local;
+                for (int i = 0; i < ITERATIONS; ++i) {
+                    for (int j = 0; j < 100; ++j) {
+                        local.PushFront(j);
+                    }
+                    local.InsertAfter(local.cbegin(), -1);
+                    assert(local.GetSize() == 101u);
+                    local.Clear();
+                }
+                for (int j = 0; j < 100; ++j) {
+                    produced[t].PushFront(t);
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        for (int t = 0; t < THREAD_COUNT; ++t) {
+            assert(produced[t].GetSize() == 100u);
+            assert(all_of(produced[t].begin(), produced[t].end(), [t](int value) {
+                return value == t;
+            }));
+            produced[t].Clear();
+        }
+    }
+}
+
+namespace std {
+
+template <>
+struct hash<compare_test::Counted> {
+    size_t operator()(const compare_test::Counted& counted) const noexcept {
+        return hash<int>{}(counted.value);
+    }
+};
+
+}  // namespace std
+
+// Эта функция проверяет хеширование списков и отпечаток IncrementalFingerprint
+void Test22() {
+    using namespace std;
+    using compare_test::Counted;
+    using FingerprintList
+        = SingleLinkedList<int, std::allocator<int>, TailTracking, NoListStatistics, NoNodeReserve, IncrementalFingerprint>;
+    // Хеш, вычисленный обходом списка без отпечатка
+    const auto traversal_hash = [](const FingerprintList& list) {
+        return SingleLinkedList<int>(list.begin(), list.end()).GetHash();
+    };
+
+    // При политике IncrementalFingerprint элементы доступны только для чтения
+    static_assert(is_same_v<FingerprintList::Iterator, FingerprintList::ConstIterator>);
+    static_assert(is_same_v<decltype(*declval<FingerprintList&>().begin()), const int&>);
+    static_assert(is_same_v<decltype(declval<FingerprintList&>().EmplaceFront(1)), const int&>);
+    static_assert(is_same_v<decltype(declval<FingerprintList&>().Back()), const int&>);
+    static_assert(sizeof(SingleLinkedList<int, std::allocator<int>, NoTailTracking, NoListStatistics, NoNodeReserve,
+                                          IncrementalFingerprint>)
+                  == sizeof(SingleLinkedList<int>) + 3 * sizeof(std::uint64_t));
+
+    // Хеш зависит от порядка и длины и совпадает у равных списков
+    {
+        using List = SingleLinkedList<int>;
+        assert((List{1, 2}.GetHash() == List{1, 2}.GetHash()));
+        assert((List{1, 2}.GetHash() != List{2, 1}.GetHash()));
+        assert(List{}.GetHash() != List{0}.GetHash());
+        assert((List{0}.GetHash() != List{0, 0}.GetHash()));
+        assert((hash<List>{}(List{5, 6}) == List{5, 6}.GetHash()));
+
+        FingerprintList tracked{1, 2};
+        assert((tracked.GetHash() == List{1, 2}.GetHash()));
+    }
+
+    // Операции в начале и в конце списка обновляют отпечаток, остальные помечают его устаревшим
+    {
+        FingerprintList list;
+        const size_t empty_hash = list.GetHash();
+        list.PushFront(3);
+        list.EmplaceFront(2);
+        list.PushBack(4);
+        list.InsertAfter(list.cbefore_begin(), 1);
+        assert((list == FingerprintList{1, 2, 3, 4}));
+        assert(list.GetHash() == traversal_hash(list));
+
+        list.PopFront();
+        list.EraseAfter(list.cbefore_begin());
+        assert(list.GetHash() == traversal_hash(list));
+
+        list.InsertAfter(list.cbegin(), 10);
+        assert(list.GetHash() == traversal_hash(list));
+        list.EraseAfter(list.cbegin());
+        list.PushFront(5);
+        assert(list.GetHash() == traversal_hash(list));
+
+        list.Sort();
+        assert((list == FingerprintList{3, 4, 5}));
+        assert(list.GetHash() == traversal_hash(list));
+
+        FingerprintList other{7, 8};
+        list.SpliceAfter(list.cbegin(), other, other.cbegin());
+        assert(list.GetHash() == traversal_hash(list));
+        assert(other.GetHash() == traversal_hash(other));
+
+        const vector<int> batch{0, 1};
+        list.PushFrontBatch(batch.begin(), batch.end());
+        list.Assign({9, 8, 7});
+        list.PushBack(6);
+        assert(list.GetHash() == traversal_hash(list));
+        list.Remove(8);
+        list.Unique();
+        assert(list.GetHash() == traversal_hash(list));
+
+        while (!list.IsEmpty()) {
+            list.PopFront();
+        }
+        assert(list.GetHash() == empty_hash);
+        list.PushFront(1);
+        list.Clear();
+        assert(list.GetHash() == empty_hash);
+    }
+
+    // Копирование, перемещение и обмен сохраняют отпечаток
+    {
+        FingerprintList list{1, 2, 3};
+        const size_t hash = list.GetHash();
+        FingerprintList copy(list);
+        assert(copy.GetHash() == hash);
+        FingerprintList moved(std::move(copy));
+        assert(moved.GetHash() == hash);
+        assert(copy.GetHash() == FingerprintList{}.GetHash());
+        copy.PushFront(0);
+        copy = list;
+        assert(copy.GetHash() == hash);
+        FingerprintList other{4};
+        swap(other, moved);
+        assert(other.GetHash() == hash);
+        assert(moved.GetHash() == traversal_hash(moved));
+    }
+
+    // Разные отпечатки позволяют отвергнуть списки одной длины без сравнения элементов
+    {
+        using CountedList = SingleLinkedList<Counted, std::allocator<Counted>, NoTailTracking, NoListStatistics,
+                                             NoNodeReserve, IncrementalFingerprint>;
+        CountedList lhs;
+        CountedList rhs;
+        for (int i = 0; i < 100; ++i) {
+            lhs.PushFront(Counted{i});
+            rhs.PushFront(Counted{i == 0 ? -1 : i});
+        }
+        Counted::equal_calls = 0;
+        assert(lhs != rhs);
+        assert(Counted::equal_calls == 0);
+
+        rhs.PopFront();
+        rhs.PushFront(Counted{99});
+        assert(lhs != rhs);
+        assert(Counted::equal_calls == 0);
+
+        const CountedList copy = lhs;
+        assert(copy == lhs);
+        assert(Counted::equal_calls == 100);
+    }
+
+    // Списки как ключи неупорядоченных контейнеров
+    {
+        unordered_set<FingerprintList> unique_lists;
+        for (int i = 0; i < 1000; ++i) {
+            FingerprintList key;
+            key.PushFront(i % 10);
+            key.PushFront(i % 3);
+            unique_lists.insert(std::move(key));
+        }
+        assert(unique_lists.size() == 30u);
+        assert(unique_lists.count(FingerprintList{2, 5}) == 1u);
+        assert(unique_lists.count(FingerprintList{5, 2}) == 0u);
+
+        unordered_map<SingleLinkedList<string>, int> counts;
+        ++counts[SingleLinkedList<string>{"a", "b"}];
+        ++counts[SingleLinkedList<string>{"a", "b"}];
+        ++counts[SingleLinkedList<string>{"b", "a"}];
+        assert(counts.size() == 2u);
+        assert((counts.at(SingleLinkedList<string>{"a", "b"}) == 2));
+    }
+}
+
+void Test23() {
+    using namespace std;
+    using IndexedList
+        = SingleLinkedList<int, std::allocator<int>, TailTracking, NoListStatistics, NoNodeReserve, NoFingerprint, SkipIndex>;
+    // Проверяет At, Advance и LowerBound по каждой позиции списка, содержимое которого совпадает с expected
+    const auto check = [](const IndexedList& list, const vector<int>& expected) {
+        assert(list.GetSize() == expected.size());
+        assert(equal(list.begin(), list.end(), expected.begin(), expected.end()));
+        for (size_t i = 0; i < expected.size(); ++i) {
+            assert(list.At(i) == expected[i]);
+            assert(*list.Advance(list.cbefore_begin(), i + 1) == expected[i]);
+        }
+        assert(list.Advance(list.cbefore_begin(), expected.size() + 1) == list.cend());
+    };
+
+    // Без политики SkipIndex узел не увеличивается
+    static_assert(sizeof(SingleLinkedList<int, std::allocator<int>, TailTracking, NoListStatistics, NoNodeReserve,
+                                          NoFingerprint, NoSkipIndex>)
+                  == sizeof(SingleLinkedList<int, std::allocator<int>, TailTracking>));
+
+    // Пустой список и выход за границы
+    {
+        IndexedList list;
+        check(list, {});
+        assert(list.LowerBound(1) == list.end());
+        assert(list.LowerBoundBefore(1) == list.before_begin());
+        try {
+            (void)list.At(0);
+            assert(false);
+        } catch (const out_of_range&) {
+        }
+        list.PushBack(1);
+        assert(list.At(0) == 1);
+        try {
+            (void)std::as_const(list).At(1);
+            assert(false);
+        } catch (const out_of_range&) {
+        }
+    }
+
+    // Упорядоченная вставка через LowerBoundBefore и удаление по номеру поддерживают индекс
+    {
+        IndexedList list;
+        vector<int> expected;
+        uint32_t state = 12345;
+        const auto next_random = [&state] {
+            state = state * 1664525u + 1013904223u;
+            return static_cast<int>(state >> 8);
+        };
+        for (int i = 0; i < 3000; ++i) {
+            const int value = next_random() % 1000;
+            list.InsertAfter(list.LowerBoundBefore(value), value);
+            expected.insert(lower_bound(expected.begin(), expected.end(), value), value);
+            if (i % 3 == 2) {
+                const size_t index = static_cast<size_t>(next_random()) % expected.size();
+                list.EraseAfter(list.Advance(list.cbefore_begin(), index));
+                expected.erase(expected.begin() + static_cast<ptrdiff_t>(index));
+            }
+        }
+        check(list, expected);
+
+        for (int value = -1; value <= 1000; value += 7) {
+            const auto found = lower_bound(expected.begin(), expected.end(), value);
+            const auto it = list.LowerBound(value);
+            if (found == expected.end()) {
+                assert(it == list.end());
+            } else {
+                assert(*it == *found);
+                assert(distance(list.begin(), it) == distance(expected.begin(), found));
+            }
+            const auto before = list.LowerBoundBefore(value);
+            assert(next(before) == it);
+        }
+
+        // Advance от произвольной позиции
+        const auto middle = list.Advance(list.cbefore_begin(), 100);
+        assert(*list.Advance(middle, 1000) == expected[1099]);
+        assert(list.Advance(middle, expected.size() - 99) == list.cend());
+
+        // Сравнитель задаёт порядок сортировки
+        IndexedList descending{9, 7, 7, 3, 1};
+        assert(*descending.LowerBound(7, greater<>()) == 7);
+        assert(descending.LowerBoundBefore(7, greater<>()) == descending.begin());
+        assert(*descending.LowerBound(5, greater<>()) == 3);
+    }
+
+    // Операции в начале и в конце списка поддерживают индекс, остальные помечают его устаревшим
+    {
+        IndexedList list;
+        vector<int> expected;
+        for (int i = 0; i < 500; ++i) {
+            list.PushFront(-i);
+            expected.insert(expected.begin(), -i);
+            list.PushBack(i);
+            expected.push_back(i);
+        }
+        check(list, expected);
+        for (int i = 0; i < 400; ++i) {
+            list.PopFront();
+        }
+        expected.erase(expected.begin(), expected.begin() + 400);
+        check(list, expected);
+
+        list.Sort(greater<>());
+        sort(expected.begin(), expected.end(), greater<>());
+        check(list, expected);
+
+        list.Remove(0);
+        expected.erase(remove(expected.begin(), expected.end(), 0), expected.end());
+        list.EraseAfter(list.cbegin(), list.Advance(list.cbegin(), 50));
+        expected.erase(expected.begin() + 1, expected.begin() + 50);
+        check(list, expected);
+
+        IndexedList other{1000, 1001};
+        list.SpliceAfter(list.cbefore_begin(), other, other.cbefore_begin());
+        expected.insert(expected.begin(), 1000);
+        check(list, expected);
+        check(other, {1001});
+
+        const vector<int> batch(100, 7);
+        list.InsertAfter(list.Advance(list.cbefore_begin(), 300), batch.begin(), batch.end());
+        expected.insert(expected.begin() + 300, batch.begin(), batch.end());
+        check(list, expected);
+
+        // Копия строит свой индекс, перемещение и обмен переносят его вместе с узлами
+        IndexedList copy = list;
+        check(copy, expected);
+        IndexedList moved = std::move(list);
+        check(moved, expected);
+        check(list, {});
+        moved.swap(list);
+        check(list, expected);
+        list = copy;
+        check(list, expected);
+
+        list.Clear();
+        check(list, {});
+        list.PushFront(1);
+        check(list, {1});
+    }
+
+    // После сильного уменьшения списка индекс перестраивается под новый размер
+    {
+        IndexedList list;
+        vector<int> expected;
+        for (int i = 0; i < 20000; ++i) {
+            list.PushBack(i);
+            expected.push_back(i);
+        }
+        assert(list.At(12345) == 12345);
+        while (list.GetSize() > 10) {
+            list.EraseAfter(list.cbegin());
+            expected.erase(expected.begin() + 1);
+        }
+        check(list, expected);
+    }
+}
+
+void Test24() {
+    using namespace std;
+    // Значение, копирование которого выбрасывает исключение, когда счётчик countdown доходит до нуля
+    struct FuzzValue {
+        FuzzValue(int value, int* countdown) noexcept
+            : value(value)
+            , countdown(countdown) {
+        }
+        FuzzValue(const FuzzValue& other)
+            : value(other.value)
+            , countdown(other.countdown) {
+            if (countdown != nullptr && (*countdown)-- == 0) {
+                throw bad_alloc();
+            }
+        }
+        FuzzValue& operator=(const FuzzValue&) = default;
+        int value;
+        int* countdown;
+    };
+    using List = SingleLinkedList<FuzzValue>;
+    using Oracle = forward_list<int>;
+    const auto same_content = [](const List& list, const Oracle& oracle) {
+        return equal(list.begin(), list.end(), oracle.begin(), oracle.end(), [](const FuzzValue& lhs, int rhs) {
+            return lhs.value == rhs;
+        });
+    };
+
+    // Случайные чередования операций сравниваются с std::forward_list. Размер проверяется после
+    // каждого шага, содержимое - периодически. Каждая копия может выбросить исключение,
+    // и тогда списки должны остаться в прежнем состоянии
+    int countdown = -1;
+    mt19937 random(2024);
+    List list;
+    List other;
+    Oracle oracle;
+    Oracle other_oracle;
+    size_t size = 0;
+    size_t other_size = 0;
+    // Позиция, с которой работают InsertAfter и EraseAfter, в списке и в оракуле
+    auto pos = list.cbefore_begin();
+    auto oracle_pos = oracle.cbefore_begin();
+    size_t throws = 0;
+
+    constexpr int STEPS = 20000;
+    for (int step = 0; step < STEPS; ++step) {
+        // Примерно одна копия из восьми выбрасывает исключение
+        countdown = random() % 8 == 0 ? static_cast<int>(random() % 3) : -1;
+        const int value = static_cast<int>(random() % 1000);
+        const FuzzValue item(value, &countdown);
+        const unsigned operation = random() % 100;
+        try {
+            if (operation < 30) {
+                pos = list.InsertAfter(pos, item);
+                oracle_pos = oracle.insert_after(oracle_pos, value);
+                ++size;
+            } else if (operation < 50) {
+                if (next(pos) != list.cend()) {
+                    list.EraseAfter(pos);
+                    oracle.erase_after(oracle_pos);
+                    --size;
+                }
+            } else if (operation < 65) {
+                list.PushFront(item);
+                oracle.push_front(value);
+                ++size;
+            } else if (operation < 80) {
+                if (size > 0) {
+                    // PopFront делает недействительным итератор на первый элемент
+                    if (pos == list.cbegin()) {
+                        pos = list.cbefore_begin();
+                        oracle_pos = oracle.cbefore_begin();
+                    }
+                    list.PopFront();
+                    oracle.pop_front();
+                    --size;
+                }
+            } else if (operation < 88) {
+                // Сдвигаем позицию вперёд либо возвращаемся в начало
+                for (unsigned i = random() % 16; i > 0 && next(pos) != list.cend(); --i) {
+                    ++pos;
+                    ++oracle_pos;
+                }
+                if (random() % 4 == 0) {
+                    pos = list.cbefore_begin();
+                    oracle_pos = oracle.cbefore_begin();
+                }
+            } else if (operation < 93) {
+                list.swap(other);
+                oracle.swap(other_oracle);
+                std::swap(size, other_size);
+                pos = list.cbefore_begin();
+                oracle_pos = oracle.cbefore_begin();
+            } else if (operation < 97) {
+                List copy(list);
+                assert(copy.GetSize() == size);
+                assert(same_content(copy, oracle));
+            } else {
+                other = list;
+                other_oracle = oracle;
+                other_size = size;
+            }
+        } catch (const bad_alloc&) {
+            ++throws;
+        }
+        assert(list.GetSize() == size);
+        assert(other.GetSize() == other_size);
+        if (step % 64 == 0) {
+            assert(same_content(list, oracle));
+            assert(same_content(other, other_oracle));
+        }
+    }
+    countdown = -1;
+    assert(same_content(list, oracle));
+    assert(same_content(other, other_oracle));
+    assert(throws > 0);
+}
+
+void Test25() {
+    using namespace std;
+    using TailList = SingleLinkedList<int, std::allocator<int>, TailTracking>;
+
+    // Reverse меняет только указатели: элементы остаются на своих адресах
+    {
+        TailList list{1, 2, 3, 4};
+        const int* first = &*list.begin();
+        list.Reverse();
+        assert((list == TailList{4, 3, 2, 1}));
+        assert(&list.Back() == first);
+        list.PushBack(0);
+        assert((list == TailList{4, 3, 2, 1, 0}));
+
+        TailList empty;
+        empty.Reverse();
+        assert(empty.IsEmpty());
+        TailList single{7};
+        single.Reverse();
+        assert(single.Back() == 7 && *single.begin() == 7);
+    }
+
+    // RotateAfter для всего списка и для интервала
+    {
+        SingleLinkedList<int> list{1, 2, 3, 4, 5};
+        list.RotateAfter(next(list.cbegin()));
+        assert((list == SingleLinkedList<int>{3, 4, 5, 1, 2}));
+        list.RotateAfter(list.cbefore_begin());
+        list.RotateAfter(next(list.cbegin(), 4));
+        assert((list == SingleLinkedList<int>{3, 4, 5, 1, 2}));
+
+        // (4 5 1) -> (1 4 5)
+        const auto first = list.cbegin();
+        list.RotateAfter(first, next(first, 2), next(first, 4));
+        assert((list == SingleLinkedList<int>{3, 1, 4, 5, 2}));
+        // Интервал до конца списка
+        list.RotateAfter(list.cbefore_begin(), next(list.cbegin(), 2), list.cend());
+        assert((list == SingleLinkedList<int>{5, 2, 3, 1, 4}));
+        // middle совпадает с first или стоит перед last
+        list.RotateAfter(list.cbegin(), list.cbegin(), list.cend());
+        list.RotateAfter(list.cbefore_begin(), next(list.cbegin(), 4), list.cend());
+        assert((list == SingleLinkedList<int>{5, 2, 3, 1, 4}));
+
+        TailList tracked{1, 2, 3};
+        tracked.RotateAfter(tracked.cbegin());
+        assert((tracked == TailList{2, 3, 1}));
+        assert(tracked.Back() == 1);
+        tracked.RotateAfter(tracked.cbefore_begin(), tracked.cbegin(), next(tracked.cbegin(), 2));
+        assert((tracked == TailList{3, 2, 1}));
+        assert(tracked.Back() == 1);
+        tracked.RotateAfter(tracked.cbegin(), next(tracked.cbegin()), tracked.cend());
+        assert((tracked == TailList{3, 1, 2}));
+        assert(tracked.Back() == 2);
+    }
+
+    // SplitAfter отдаёт хвост списка без копирования элементов
+    {
+        TailList list{1, 2, 3, 4, 5};
+        const int* third = &*next(list.begin(), 2);
+        TailList tail = list.SplitAfter(next(list.cbegin()));
+        assert((list == TailList{1, 2}));
+        assert((tail == TailList{3, 4, 5}));
+        assert(list.GetSize() == 2u && tail.GetSize() == 3u);
+        assert(list.Back() == 2 && tail.Back() == 5);
+        assert(&*tail.begin() == third);
+        list.PushBack(6);
+        tail.PushBack(7);
+        assert((list == TailList{1, 2, 6}));
+        assert((tail == TailList{3, 4, 5, 7}));
+
+        assert(list.SplitAfter(next(list.cbegin(), 2)).IsEmpty());
+        TailList all = list.SplitAfter(list.cbefore_begin());
+        assert(list.IsEmpty() && (all == TailList{1, 2, 6}));
+        list.PushBack(1);
+        assert(list.GetSize() == 1u && list.Back() == 1);
+    }
+
+    // SplitEvery выделяет память только под вектор частей
+    {
+        auto& counters = AllocationCounters::Instance();
+        using List = SingleLinkedList<int, CountingAllocator<int>, TailTracking>;
+        List list{1, 2, 3, 4, 5, 6, 7};
+        counters = {};
+        vector<List> parts = list.SplitEvery(3);
+        assert(counters.allocations == 0);
+        assert(list.IsEmpty());
+        assert(parts.size() == 3u);
+        assert((parts[0] == List{1, 2, 3}));
+        assert((parts[1] == List{4, 5, 6}));
+        assert((parts[2] == List{7}));
+        assert(parts[1].Back() == 6 && parts[2].GetSize() == 1u);
+
+        List whole{1, 2};
+        counters = {};
+        const vector<List> single = whole.SplitEvery(10);
+        assert(List{}.SplitEvery(2).empty());
+        assert(counters.allocations == 0);
+        assert(single.size() == 1u && (single[0] == List{1, 2}));
+    }
+
+    // Перестановки учитываются отпечатком и индексом
+    {
+        using FingerprintList
+            = SingleLinkedList<int, std::allocator<int>, TailTracking, NoListStatistics, NoNodeReserve, IncrementalFingerprint>;
+        FingerprintList list{1, 2, 3, 4};
+        list.Reverse();
+        assert(list.GetHash() == (SingleLinkedList<int>{4, 3, 2, 1}.GetHash()));
+        list.RotateAfter(list.cbegin());
+        assert(list.GetHash() == (SingleLinkedList<int>{3, 2, 1, 4}.GetHash()));
+        FingerprintList tail = list.SplitAfter(list.cbegin());
+        assert(list.GetHash() == SingleLinkedList<int>{3}.GetHash());
+        assert(tail.GetHash() == (SingleLinkedList<int>{2, 1, 4}.GetHash()));
+
+        using IndexedList = SingleLinkedList<int, std::allocator<int>, TailTracking, NoListStatistics, NoNodeReserve,
+                                             NoFingerprint, SkipIndex>;
+        IndexedList indexed;
+        for (int i = 0; i < 100; ++i) {
+            indexed.PushBack(i);
+        }
+        assert(indexed.At(10) == 10);
+        indexed.Reverse();
+        assert(indexed.At(10) == 89);
+        indexed.RotateAfter(next(indexed.cbegin(), 49));
+        assert(indexed.At(0) == 49 && indexed.At(50) == 99);
+        IndexedList indexed_tail = indexed.SplitAfter(next(indexed.cbegin(), 59));
+        assert(indexed.At(59) == 90 && indexed_tail.At(0) == 89);
+        vector<IndexedList> parts = indexed_tail.SplitEvery(16);
+        assert(parts.size() == 3u && parts[2].At(7) == 50);
+    }
+}
+
 void Test() {
     Test0();
     Test1();
@@ -717,6 +3072,26 @@ void Test() {
     Test3();
     Test4();
     Test5();
+    Test6();
+    Test7();
+    Test8();
+    Test9();
+    Test10();
+    Test11();
+    Test12();
+    Test13();
+    Test14();
+    Test15();
+    Test16();
+    Test17();
+    Test18();
+    Test19();
+    Test20();
+    Test21();
+    Test22();
+    Test23();
+    Test24();
+    Test25();
 
     std::cerr << "TEST OK" << std::endl;
 }
\ No newline at end of file
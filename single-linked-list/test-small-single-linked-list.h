@@ -0,0 +1,251 @@
+#pragma once
+
+#include <cassert>
+#include <forward_list>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace small_test {
+
+// Подсчитывает живые объекты, чтобы обнаружить лишние и потерянные разрушения
+struct Counted {
+    explicit Counted(int value)
+        : value(value) {
+        ++alive;
+    }
+
+    Counted(const Counted& other)
+        : value(other.value) {
+        ++alive;
+    }
+
+    Counted(Counted&& other) noexcept
+        : value(std::exchange(other.value, -1)) {
+        ++alive;
+    }
+
+    Counted& operator=(const Counted&) = default;
+
+    ~Counted() {
+        --alive;
+    }
+
+    bool operator==(const Counted& other) const {
+        return value == other.value;
+    }
+
+    inline static int alive = 0;
+    int value = 0;
+};
+
+// Значение без перемещающего конструктора: перемещение копирует и может выбросить исключение.
+// Исключение выбрасывает копия с номером copies_before_throw, считая с нуля
+struct ThrowingMove {
+    explicit ThrowingMove(int value)
+        : value(value) {
+    }
+
+    ThrowingMove(const ThrowingMove& other)
+        : value(other.value) {
+        if (copies_before_throw >= 0 && copies_before_throw-- == 0) {
+            throw std::runtime_error("copy");
+        }
+    }
+
+    ThrowingMove& operator=(const ThrowingMove&) = default;
+
+    inline static int copies_before_throw = -1;
+    int value = 0;
+};
+
+}  // namespace small_test
+
+// Эта функция проверяет работу SmallSingleLinkedList
+void TestSmallList() {
+    using namespace std;
+    using small_test::Counted;
+
+    // Пустой список
+    {
+        const SmallSingleLinkedList<int> list;
+        assert(list.IsEmpty());
+        assert(list.GetSize() == 0u);
+        assert(list.GetInlineSize() == 0u);
+        assert(list.begin() == list.end());
+        assert(++list.cbefore_begin() == list.cbegin());
+        static_assert(SmallSingleLinkedList<int, 3>::INLINE_CAPACITY == 3);
+    }
+
+    // Первые N узлов размещаются внутри списка, остальные - в куче
+    {
+        SmallSingleLinkedList<int, 3> list;
+        list.PushFront(3);
+        list.PushFront(2);
+        list.PushFront(1);
+        assert(list.GetInlineSize() == 3u);
+        const auto* list_begin = reinterpret_cast<const char*>(&list);
+        const auto* list_end = list_begin + sizeof(list);
+        const auto* front = reinterpret_cast<const char*>(&list.Front());
+        assert(front >= list_begin && front < list_end);
+
+        list.InsertAfter(list.cbegin(), 10);
+        assert(list.GetSize() == 4u);
+        assert(list.GetInlineSize() == 3u);
+        assert((list == SmallSingleLinkedList<int, 3>{1, 10, 2, 3}));
+
+        // Освобождённая встроенная ячейка используется снова
+        list.PopFront();
+        assert(list.GetInlineSize() == 2u);
+        list.PushFront(0);
+        assert(list.GetInlineSize() == 3u);
+        list.EraseAfter(list.cbegin());
+        assert(list.GetInlineSize() == 3u);
+        assert((list == SmallSingleLinkedList<int, 3>{0, 2, 3}));
+
+        list.Clear();
+        assert(list.IsEmpty());
+        assert(list.GetInlineSize() == 0u);
+        list.PushFront(7);
+        assert(list.GetInlineSize() == 1u);
+        assert(list.Front() == 7);
+    }
+
+    // Перемещение переносит встроенные элементы и передаёт узлы из кучи
+    {
+        SmallSingleLinkedList<string, 2> list{"a", "b", "c", "d"};
+        const string* heap_element = &*++(++list.begin());
+        SmallSingleLinkedList<string, 2> moved(std::move(list));
+        assert(list.IsEmpty());
+        assert(list.GetInlineSize() == 0u);
+        assert(moved.GetSize() == 4u);
+        assert(moved.GetInlineSize() == 2u);
+        assert((moved == SmallSingleLinkedList<string, 2>{"a", "b", "c", "d"}));
+        assert(&*++(++moved.begin()) == heap_element);
+
+        list.PushFront("x");
+        list = std::move(moved);
+        assert(moved.IsEmpty());
+        assert((list == SmallSingleLinkedList<string, 2>{"a", "b", "c", "d"}));
+
+        // Встроенные узлы могут стоять в середине списка
+        SmallSingleLinkedList<string, 2> mixed;
+        mixed.PushFront("3");
+        mixed.PushFront("2");
+        mixed.PopFront();
+        mixed.PushFront("1");
+        mixed.PushFront("0");
+        mixed.PushFront("2");
+        SmallSingleLinkedList<string, 2> mixed_moved(std::move(mixed));
+        assert((mixed_moved == SmallSingleLinkedList<string, 2>{"2", "0", "1", "3"}));
+        assert(mixed_moved.GetInlineSize() == 2u);
+    }
+
+    // Копирование и обмен
+    {
+        SmallSingleLinkedList<int, 2> first{1, 2, 3};
+        SmallSingleLinkedList<int, 2> second{4};
+        const SmallSingleLinkedList<int, 2> copy(first);
+        assert(copy == first);
+        assert(copy.GetInlineSize() == 2u);
+
+        swap(first, second);
+        assert((first == SmallSingleLinkedList<int, 2>{4}));
+        assert((second == SmallSingleLinkedList<int, 2>{1, 2, 3}));
+        first.swap(first);
+        assert(first.GetSize() == 1u);
+
+        second = first;
+        assert(second == first);
+        assert(copy < first);
+        assert(first > copy && first >= copy && copy <= first && first != copy);
+
+        forward_list<int> values(copy.begin(), copy.end());
+        assert((values == forward_list<int>{1, 2, 3}));
+    }
+
+    // Все элементы разрушаются ровно один раз
+    {
+        {
+            SmallSingleLinkedList<Counted, 2> list;
+            for (int i = 0; i < 5; ++i) {
+                list.EmplaceFront(i);
+            }
+            SmallSingleLinkedList<Counted, 2> other(list);
+            other.swap(list);
+            SmallSingleLinkedList<Counted, 2> moved(std::move(other));
+            moved.PopFront();
+            assert(Counted::alive == 9);
+        }
+        assert(Counted::alive == 0);
+    }
+
+    // Исключение при создании элемента не меняет список
+    {
+        struct ThrowOnCopy {
+            ThrowOnCopy() = default;
+            ThrowOnCopy(const ThrowOnCopy&) {
+                throw runtime_error("copy");
+            }
+        };
+        SmallSingleLinkedList<ThrowOnCopy, 1> list;
+        list.EmplaceFront();
+        const ThrowOnCopy value;
+        bool exception_was_thrown = false;
+        try {
+            list.PushFront(value);
+        } catch (const runtime_error&) {
+            exception_was_thrown = true;
+        }
+        assert(exception_was_thrown);
+        assert(list.GetSize() == 1u);
+        assert(list.GetInlineSize() == 1u);
+        list.PopFront();
+        exception_was_thrown = false;
+        try {
+            list.PushFront(value);
+        } catch (const runtime_error&) {
+            exception_was_thrown = true;
+        }
+        assert(exception_was_thrown);
+        assert(list.GetInlineSize() == 0u);
+        list.EmplaceFront();
+        assert(list.GetInlineSize() == 1u);
+    }
+
+    // Исключение при копирующем присваивании не меняет список, даже если перемещение элементов
+    // может выбросить исключение
+    {
+        using small_test::ThrowingMove;
+        static_assert(!is_nothrow_move_constructible_v<ThrowingMove>);
+        SmallSingleLinkedList<ThrowingMove, 2> source;
+        for (int i = 0; i < 3; ++i) {
+            source.EmplaceFront(i + 10);
+        }
+        for (int copies = 0; copies < 8; ++copies) {
+            SmallSingleLinkedList<ThrowingMove, 2> list;
+            for (int i = 0; i < 3; ++i) {
+                list.EmplaceFront(i);
+            }
+            ThrowingMove::copies_before_throw = copies;
+            bool exception_was_thrown = false;
+            try {
+                list = source;
+            } catch (const runtime_error&) {
+                exception_was_thrown = true;
+            }
+            ThrowingMove::copies_before_throw = -1;
+            assert(list.GetSize() == 3u);
+            int expected = exception_was_thrown ? 2 : 12;
+            for (const ThrowingMove& value : list) {
+                assert(value.value == expected--);
+            }
+            assert(exception_was_thrown == (copies < 3));
+        }
+    }
+
+    std::cerr << "SMALL TEST OK" << std::endl;
+}
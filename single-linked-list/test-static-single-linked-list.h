@@ -0,0 +1,154 @@
+#pragma once
+
+#include <cassert>
+#include <forward_list>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace static_test {
+
+// Таблица, построенная во время компиляции: вставки, удаления и повторное использование ячеек
+constexpr StaticSingleLinkedList<int, 4> MakeTable() {
+    StaticSingleLinkedList<int, 4> table{1, 3};
+    table.InsertAfter(table.cbegin(), 2);
+    table.PushFront(0);
+    table.PopFront();
+    table.EraseAfter(table.cbegin());
+    table.PushFront(-1);
+    table.EmplaceFront(-2);
+    return table;
+}
+
+constexpr StaticSingleLinkedList<int, 4> TABLE = MakeTable();
+
+static_assert(TABLE.GetSize() == 4);
+static_assert(TABLE.IsFull());
+static_assert(TABLE.Front() == -2);
+static_assert(*++TABLE.begin() == -1);
+static_assert((TABLE == StaticSingleLinkedList<int, 4>{-2, -1, 1, 3}));
+static_assert((TABLE < StaticSingleLinkedList<int, 4>{-2, 0}));
+static_assert(TABLE.CompareTo(StaticSingleLinkedList<int, 4>{-2, -1, 1}) > 0);
+
+// Цепочка пар ключ-значение. Присваивание std::pair становится constexpr только в C++20
+struct NamedValue {
+    std::string_view name;
+    int value = 0;
+};
+
+constexpr StaticSingleLinkedList<NamedValue, 3> NAMES{{"one", 1}, {"two", 2}, {"three", 3}};
+
+constexpr int FindName(std::string_view name) {
+    for (const auto& [key, value] : NAMES) {
+        if (key == name) {
+            return value;
+        }
+    }
+    return 0;
+}
+
+static_assert(FindName("two") == 2);
+static_assert(FindName("four") == 0);
+
+#if __cplusplus > 201703L
+constexpr StaticSingleLinkedList<std::pair<int, char>, 2> PAIRS{{1, 'a'}, {2, 'b'}};
+static_assert(PAIRS.Front().second == 'a');
+#endif
+
+// Индексы занимают столько байт, сколько нужно для ёмкости
+static_assert(sizeof(StaticSingleLinkedList<char, 16>) == 16 + 17 + 3);
+
+constexpr bool TestClearAndSwap() {
+    StaticSingleLinkedList<int, 3> lhs{1, 2, 3};
+    StaticSingleLinkedList<int, 3> rhs{4};
+    lhs.swap(rhs);
+    if (lhs.GetSize() != 1 || rhs.GetSize() != 3 || lhs.Front() != 4) {
+        return false;
+    }
+    rhs.Clear();
+    rhs.PushFront(5);
+    rhs.PushFront(6);
+    return rhs.GetSize() == 2 && rhs.Front() == 6 && lhs != rhs;
+}
+
+static_assert(TestClearAndSwap());
+
+}  // namespace static_test
+
+// Эта функция проверяет работу StaticSingleLinkedList
+void TestStaticList() {
+    using namespace std;
+
+    // Пустой список
+    {
+        const StaticSingleLinkedList<int, 2> list;
+        assert(list.IsEmpty());
+        assert(!list.IsFull());
+        assert(list.begin() == list.end());
+        assert(++list.cbefore_begin() == list.cbegin());
+    }
+
+    // Во время выполнения список работает с нелитеральными типами
+    {
+        StaticSingleLinkedList<string, 3> list{"a", "c"};
+        auto pos = list.InsertAfter(list.cbegin(), "b"s);
+        assert(*pos == "b");
+        assert(list.IsFull());
+        forward_list<string> values(list.begin(), list.end());
+        assert((values == forward_list<string>{"a", "b", "c"}));
+
+        // Переполнение выбрасывает length_error и не меняет список
+        bool exception_was_thrown = false;
+        try {
+            list.PushFront("x");
+        } catch (const length_error&) {
+            exception_was_thrown = true;
+        }
+        assert(exception_was_thrown);
+        assert(list.GetSize() == 3u);
+
+        list.EraseAfter(list.cbegin());
+        list.PushFront("0");
+        assert((list == StaticSingleLinkedList<string, 3>{"0", "a", "c"}));
+
+        StaticSingleLinkedList<string, 3> copy(list);
+        assert(copy == list);
+        copy.Front() = "z";
+        assert(copy > list && list < copy && list <= copy && copy >= list);
+        swap(copy, list);
+        assert(list.Front() == "z");
+        list.Clear();
+        assert(list.IsEmpty());
+        list.EmplaceFront(2, 'y');
+        assert(list.Front() == "yy");
+    }
+
+    // Исключение при создании элемента не меняет список
+    {
+        struct ThrowOnCopy {
+            ThrowOnCopy() = default;
+            ThrowOnCopy(const ThrowOnCopy&) {
+                throw runtime_error("copy");
+            }
+            ThrowOnCopy(ThrowOnCopy&&) = default;
+            ThrowOnCopy& operator=(ThrowOnCopy&&) = default;
+        };
+        StaticSingleLinkedList<ThrowOnCopy, 2> list;
+        list.EmplaceFront();
+        const ThrowOnCopy value;
+        bool exception_was_thrown = false;
+        try {
+            list.PushFront(value);
+        } catch (const runtime_error&) {
+            exception_was_thrown = true;
+        }
+        assert(exception_was_thrown);
+        assert(list.GetSize() == 1u);
+        list.EmplaceFront();
+        assert(list.IsFull());
+    }
+
+    std::cerr << "STATIC TEST OK" << std::endl;
+}
@@ -0,0 +1,216 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Эта функция проверяет работу UnrolledSingleLinkedList
+void TestUnrolledList() {
+    using namespace std;
+    // Маленькая ёмкость блока, чтобы проверить деление и освобождение блоков
+    using SmallList = UnrolledSingleLinkedList<int, 4>;
+
+    // Ёмкость блока по умолчанию заполняет около двух кеш-линий
+    static_assert(UnrolledSingleLinkedList<int>::BLOCK_CAPACITY > 16);
+    static_assert(UnrolledSingleLinkedList<std::array<char, 512>>::BLOCK_CAPACITY == 1);
+
+    // Пустой список
+    {
+        const SmallList list;
+        assert(list.IsEmpty());
+        assert(list.GetSize() == 0u);
+        assert(list.begin() == list.end());
+        assert(++list.cbefore_begin() == list.cbegin());
+    }
+
+    // Создание из initializer_list плотно заполняет блоки
+    {
+        SmallList list{1, 2, 3, 4, 5, 6, 7, 8, 9};
+        assert(list.GetSize() == 9u);
+        assert(list.GetBlockCount() == 3u);
+        const vector<int> expected{1, 2, 3, 4, 5, 6, 7, 8, 9};
+        assert(equal(list.begin(), list.end(), expected.begin(), expected.end()));
+    }
+
+    // Вставка в начало и после произвольной позиции
+    {
+        SmallList list;
+        for (int i = 10; i > 0; --i) {
+            list.PushFront(i);
+        }
+        assert(list.GetSize() == 10u);
+        assert((list == SmallList{1, 2, 3, 4, 5, 6, 7, 8, 9, 10}));
+
+        // Вставка в середину заполненного блока делит его
+        SmallList full{1, 2, 3, 4};
+        auto it = full.InsertAfter(full.cbegin(), 10);
+        assert(*it == 10);
+        assert(full.GetBlockCount() == 2u);
+        assert((full == SmallList{1, 10, 2, 3, 4}));
+
+        it = full.InsertAfter(it, 11);
+        assert(*it == 11);
+        it = full.InsertAfter(++(++(++full.cbegin())), 12);
+        assert(*it == 12);
+        assert((full == SmallList{1, 10, 11, 2, 12, 3, 4}));
+        assert(full.GetSize() == 7u);
+
+        // Вставка после последнего элемента
+        auto last = full.cbegin();
+        advance(last, 6);
+        full.InsertAfter(last, 5);
+        assert((full == SmallList{1, 10, 11, 2, 12, 3, 4, 5}));
+    }
+
+    // Удаление элементов и освобождение опустевших блоков
+    {
+        SmallList list{1, 2, 3, 4, 5, 6};
+        auto next = list.EraseAfter(list.cbegin());
+        assert(*next == 3);
+        assert((list == SmallList{1, 3, 4, 5, 6}));
+
+        // Удаляем все элементы второго блока
+        auto pos = list.cbegin();
+        advance(pos, 2);
+        next = list.EraseAfter(pos);
+        assert(*next == 6);
+        next = list.EraseAfter(pos);
+        assert(next == list.end());
+        assert((list == SmallList{1, 3, 4}));
+        assert(list.GetBlockCount() == 1u);
+
+        list.PopFront();
+        list.PopFront();
+        list.PopFront();
+        assert(list.IsEmpty());
+        assert(list.GetBlockCount() == 0u);
+        assert(list.begin() == list.end());
+    }
+
+    // Копирование, перемещение и обмен
+    {
+        UnrolledSingleLinkedList<string> list{"one"s, "two"s, "three"s};
+        auto copy(list);
+        assert(copy == list);
+        copy.PushFront("zero"s);
+        assert(copy != list);
+        assert(!(copy < list));
+
+        auto moved(move(copy));
+        assert(copy.IsEmpty());
+        assert(moved.GetSize() == 4u);
+
+        list = moved;
+        assert(list == moved);
+        copy = move(moved);
+        assert(copy == list);
+
+        swap(list, moved);
+        assert(list.IsEmpty());
+        assert(moved.GetSize() == 4u);
+    }
+
+    // Строки корректно переносятся при делении блоков
+    {
+        UnrolledSingleLinkedList<string, 3> list;
+        vector<string> expected;
+        for (int i = 0; i < 50; ++i) {
+            list.PushFront(to_string(i) + " long string to avoid small string optimization");
+            expected.insert(expected.begin(), to_string(i) + " long string to avoid small string optimization");
+        }
+        auto pos = list.cbegin();
+        auto expected_pos = expected.begin();
+        for (int i = 0; i < 25; ++i) {
+            pos = list.InsertAfter(pos, "inserted"s);
+            expected_pos = expected.insert(expected_pos + 1, "inserted"s);
+            ++pos;
+            ++expected_pos;
+        }
+        assert(equal(list.begin(), list.end(), expected.begin(), expected.end()));
+        assert(list.GetSize() == expected.size());
+    }
+
+    // Вставка элемента самого списка в заполненный блок: элемент из переносимой половины копируется до деления
+    {
+        const string tail = "last long string to avoid small string optimization";
+        UnrolledSingleLinkedList<string, 4> list{"a"s, "b"s, "c"s, tail};
+        auto last = list.cbegin();
+        advance(last, 3);
+        list.InsertAfter(list.cbegin(), *last);
+        list.EmplaceAfter(list.cbegin(), *list.cbegin());
+        assert((list == UnrolledSingleLinkedList<string, 4>{"a"s, "a"s, tail, "b"s, "c"s, tail}));
+    }
+
+    // Сравнение проходит по общим участкам блоков, заполненных по-разному
+    {
+        SmallList dense{1, 2, 3, 4, 5, 6, 7, 8, 9};
+        SmallList appended;
+        auto pos = appended.cbefore_begin();
+        for (int i = 1; i <= 9; ++i) {
+            pos = appended.InsertAfter(pos, i);
+        }
+        // Вставки в середину делят блоки, и они заполняются наполовину
+        SmallList split{1, 9};
+        auto split_pos = split.cbegin();
+        for (int i = 2; i <= 8; ++i) {
+            split_pos = split.InsertAfter(split_pos, i);
+        }
+        assert(split.GetBlockCount() != dense.GetBlockCount());
+        assert(dense == appended && dense == split);
+        assert(dense.CompareTo(split) == 0);
+        assert(dense <= split && dense >= split);
+
+        split.PopFront();
+        assert(split.CompareTo(dense) > 0);
+        assert(dense < split);
+        *(++appended.begin()) = 0;
+        assert(appended < dense && dense > appended);
+        assert(SmallList{}.CompareTo(SmallList{}) == 0);
+        assert(SmallList{} < dense);
+        assert((SmallList{1, 2} < SmallList{1, 2, 0}));
+    }
+
+    // Длинные списки арифметических типов сравниваются пачками
+    {
+        UnrolledSingleLinkedList<int64_t> lhs;
+        UnrolledSingleLinkedList<int64_t> rhs;
+        for (int64_t i = 0; i < 1000; ++i) {
+            lhs.PushFront(i);
+            rhs.PushFront(i);
+        }
+        assert(lhs == rhs);
+        assert(lhs.CompareTo(rhs) == 0);
+        rhs.PushFront(999);
+        rhs.EraseAfter(rhs.cbegin());
+        assert(lhs == rhs);
+        *rhs.begin() = 1000;
+        assert(lhs != rhs && lhs < rhs);
+        lhs.PushFront(1000);
+        assert(lhs != rhs && lhs > rhs);
+
+        UnrolledSingleLinkedList<double, 40> doubles;
+        UnrolledSingleLinkedList<double, 40> same;
+        for (int i = 0; i < 100; ++i) {
+            doubles.PushFront(i == 50 ? 0.0 : i);
+            same.PushFront(i == 50 ? -0.0 : i);
+        }
+        assert(doubles == same);
+        assert(doubles.CompareTo(same) == 0);
+        *doubles.begin() = nan("");
+        assert(doubles != same);
+        // NaN не меньше и не больше других чисел, поэтому порядок определяют следующие элементы
+        assert(doubles.CompareTo(same) == 0);
+        *(++doubles.begin()) = -1;
+        assert(doubles < same);
+    }
+
+#if __cplusplus > 201703L
+    assert((SmallList{1, 2} <=> SmallList{1, 3}) == std::weak_ordering::less);
+#endif
+
+    std::cerr << "UNROLLED TEST OK" << std::endl;
+}
@@ -0,0 +1,722 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+#if __cplusplus > 201703L
+#include <compare>
+#endif
+
+// Число элементов в блоке по умолчанию: блок вместе с заголовком занимает около двух кеш-линий
+template <typename Type>
+constexpr size_t DefaultUnrolledBlockCapacity() noexcept {
+    constexpr size_t CACHE_LINE_SIZE = 64;
+    constexpr size_t BLOCK_BYTES = 2 * CACHE_LINE_SIZE - sizeof(void*) - sizeof(size_t);
+    return std::max<size_t>(1, BLOCK_BYTES / sizeof(Type));
+}
+
+/*
+ * Развёрнутый односвязный список: каждый узел (блок) хранит до BlockCapacity элементов подряд,
+ * поэтому обход списка почти не отличается по скорости от обхода массива.
+ * Интерфейс повторяет SingleLinkedList: прямой итератор, before_begin, InsertAfter и EraseAfter.
+ * В отличие от SingleLinkedList, вставка и удаление делают недействительными итераторы
+ * на элементы того же блока, расположенные после изменяемой позиции
+ */
+template <typename Type, size_t BlockCapacity = DefaultUnrolledBlockCapacity<Type>()>
+class UnrolledSingleLinkedList {
+    static_assert(BlockCapacity > 0, "BlockCapacity must be positive");
+
+    struct Block;
+
+    // Базовая часть блока, хранящая только указатель на следующий блок.
+    // Используется для фиктивного блока head_
+    struct BlockBase {
+        Block* next_block = nullptr;
+    };
+
+    // Блок списка. Элементы занимают первые count ячеек хранилища
+    struct Block : BlockBase {
+        Type* Get(size_t index) noexcept {
+            assert(index < count);
+            return std::launder(reinterpret_cast<Type*>(storage) + index);
+        }
+
+        const Type* Get(size_t index) const noexcept {
+            assert(index < count);
+            return std::launder(reinterpret_cast<const Type*>(storage) + index);
+        }
+
+        // Возвращает адрес ячейки без проверки того, что в ней находится элемент
+        void* Slot(size_t index) noexcept {
+            return reinterpret_cast<Type*>(storage) + index;
+        }
+
+        // Переносит элемент из ячейки from в пустую ячейку to блока target
+        void RelocateTo(size_t from, Block* target, size_t to) noexcept {
+            Type* source = std::launder(reinterpret_cast<Type*>(storage) + from);
+            ::new (target->Slot(to)) Type(std::move(*source));
+            source->~Type();
+        }
+
+        size_t count = 0;
+        alignas(Type) unsigned char storage[sizeof(Type) * BlockCapacity];
+    };
+
+    // Индекс, которым помечается позиция перед первым элементом списка
+    static constexpr size_t BEFORE_BEGIN_INDEX = static_cast<size_t>(-1);
+
+    // Шаблон класса «Базовый Итератор».
+    // Итератор хранит указатель на блок и индекс элемента внутри блока
+    // ValueType — совпадает с Type (для Iterator) либо с const Type (для ConstIterator)
+    template <typename ValueType>
+    class BasicIterator {
+        friend class UnrolledSingleLinkedList;
+
+        BasicIterator(BlockBase* block, size_t index) noexcept
+            : block_(block)
+            , index_(index) {
+        }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = ValueType*;
+        using reference = ValueType&;
+
+        BasicIterator() = default;
+
+        // Конвертирующий конструктор/конструктор копирования
+        BasicIterator(const BasicIterator<Type>& other) noexcept
+            : block_(other.block_)
+            , index_(other.index_) {
+        }
+
+        BasicIterator& operator=(const BasicIterator& rhs) = default;
+
+        [[nodiscard]] bool operator==(const BasicIterator<const Type>& rhs) const noexcept {
+            return block_ == rhs.block_ && index_ == rhs.index_;
+        }
+
+        [[nodiscard]] bool operator!=(const BasicIterator<const Type>& rhs) const noexcept {
+            return !(*this == rhs);
+        }
+
+        [[nodiscard]] bool operator==(const BasicIterator<Type>& rhs) const noexcept {
+            return block_ == rhs.block_ && index_ == rhs.index_;
+        }
+
+        [[nodiscard]] bool operator!=(const BasicIterator<Type>& rhs) const noexcept {
+            return !(*this == rhs);
+        }
+
+        // Оператор прединкремента. Переход к следующему блоку происходит только после
+        // последнего элемента текущего блока
+        BasicIterator& operator++() noexcept {
+            if (index_ == BEFORE_BEGIN_INDEX) {
+                block_ = block_->next_block;
+                index_ = 0;
+            } else if (block_ != nullptr) {
+                if (++index_ == static_cast<Block*>(block_)->count) {
+                    block_ = block_->next_block;
+                    index_ = 0;
+                }
+            }
+            return *this;
+        }
+
+        BasicIterator operator++(int) noexcept {
+            auto old_it(*this);
+            ++(*this);
+            return old_it;
+        }
+
+        [[nodiscard]] reference operator*() const noexcept {
+            assert(block_ != nullptr && index_ != BEFORE_BEGIN_INDEX);
+            return *static_cast<Block*>(block_)->Get(index_);
+        }
+
+        [[nodiscard]] pointer operator->() const noexcept {
+            assert(block_ != nullptr && index_ != BEFORE_BEGIN_INDEX);
+            return static_cast<Block*>(block_)->Get(index_);
+        }
+
+    private:
+        BlockBase* block_ = nullptr;
+        size_t index_ = 0;
+    };
+
+public:
+    using value_type = Type;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+
+    using Iterator = BasicIterator<Type>;
+    using ConstIterator = BasicIterator<const Type>;
+
+    // Максимальное число элементов в одном блоке
+    static constexpr size_t BLOCK_CAPACITY = BlockCapacity;
+
+    [[nodiscard]] Iterator begin() noexcept {
+        return Iterator{head_.next_block, 0};
+    }
+
+    [[nodiscard]] Iterator end() noexcept {
+        return Iterator{};
+    }
+
+    [[nodiscard]] ConstIterator begin() const noexcept {
+        return cbegin();
+    }
+
+    [[nodiscard]] ConstIterator end() const noexcept {
+        return cend();
+    }
+
+    [[nodiscard]] ConstIterator cbegin() const noexcept {
+        return ConstIterator{head_.next_block, 0};
+    }
+
+    [[nodiscard]] ConstIterator cend() const noexcept {
+        return ConstIterator{};
+    }
+
+    // Возвращает итератор, указывающий на позицию перед первым элементом списка.
+    // Разыменовывать этот итератор нельзя - попытка разыменования приведёт к неопределённому поведению
+    [[nodiscard]] Iterator before_begin() noexcept {
+        return Iterator{&head_, BEFORE_BEGIN_INDEX};
+    }
+
+    [[nodiscard]] ConstIterator cbefore_begin() const noexcept {
+        return ConstIterator{const_cast<BlockBase*>(&head_), BEFORE_BEGIN_INDEX};
+    }
+
+    [[nodiscard]] ConstIterator before_begin() const noexcept {
+        return cbefore_begin();
+    }
+
+    UnrolledSingleLinkedList() = default;
+
+    UnrolledSingleLinkedList(std::initializer_list<Type> values);
+
+    template <typename It, typename = std::enable_if_t<std::is_convertible_v<
+                               typename std::iterator_traits<It>::iterator_category, std::input_iterator_tag>>>
+    UnrolledSingleLinkedList(It first, It last);
+
+    UnrolledSingleLinkedList(const UnrolledSingleLinkedList& other);
+
+    UnrolledSingleLinkedList(UnrolledSingleLinkedList&& other) noexcept;
+
+    UnrolledSingleLinkedList& operator=(const UnrolledSingleLinkedList& rhs);
+
+    UnrolledSingleLinkedList& operator=(UnrolledSingleLinkedList&& rhs) noexcept;
+
+    ~UnrolledSingleLinkedList();
+
+    // Обменивает содержимое списков за время O(1)
+    void swap(UnrolledSingleLinkedList& other) noexcept;
+
+    /*
+     * Вставляет элемент value после элемента, на который указывает pos, за время O(BlockCapacity).
+     * Если блок заполнен, он делится пополам.
+     * Возвращает итератор на вставленный элемент
+     * Если при создании элемента будет выброшено исключение и перемещение Type не выбрасывает
+     * исключений, список останется в прежнем состоянии
+     */
+    Iterator InsertAfter(ConstIterator pos, const Type& value);
+
+    Iterator InsertAfter(ConstIterator pos, Type&& value);
+
+    template <typename... Args>
+    Iterator EmplaceAfter(ConstIterator pos, Args&&... args);
+
+    /*
+     * Удаляет элемент, следующий за pos, за время O(BlockCapacity). Опустевший блок освобождается.
+     * Возвращает итератор на элемент, следующий за удалённым
+     */
+    Iterator EraseAfter(ConstIterator pos) noexcept;
+
+    void PushFront(const Type& value);
+
+    void PushFront(Type&& value);
+
+    template <typename... Args>
+    Type& EmplaceFront(Args&&... args);
+
+    void PopFront() noexcept;
+
+    // Очищает список за время O(N)
+    void Clear() noexcept;
+
+    [[nodiscard]] size_t GetSize() const noexcept;
+
+    [[nodiscard]] bool IsEmpty() const noexcept;
+
+    // Возвращает количество блоков списка
+    [[nodiscard]] size_t GetBlockCount() const noexcept;
+
+    /*
+     * Лексикографически сравнивает список с other за один проход.
+     * Возвращает отрицательное число, если список меньше other, ноль, если списки равны,
+     * и положительное число, если список больше. Элементы сравниваются только оператором <.
+     * Элементы арифметических типов сравниваются пачками, которые компилятор векторизует
+     */
+    [[nodiscard]] int CompareTo(const UnrolledSingleLinkedList& other) const;
+
+    // Сообщает, равны ли списки. Блоки целочисленных элементов сравниваются через memcmp
+    [[nodiscard]] bool IsEqualTo(const UnrolledSingleLinkedList& other) const;
+
+private:
+    // Количество элементов в пачке, которую сравнивают без условных переходов
+    static constexpr size_t COMPARE_BATCH_SIZE = 16;
+
+    // Вызывает compare_spans(lhs, rhs, count) для общих участков блоков двух списков, пока не получит
+    // ненулевой результат. Если общие участки равны, сравнивает длины списков
+    template <typename CompareSpans>
+    int CompareBlocks(const UnrolledSingleLinkedList& other, CompareSpans compare_spans) const;
+
+    // Сравнивает count элементов, расположенных подряд, и возвращает результат как CompareTo
+    static int CompareSpans(const Type* lhs, const Type* rhs, size_t count);
+
+    // Сообщает, равны ли count элементов, расположенных подряд
+    static bool AreSpansEqual(const Type* lhs, const Type* rhs, size_t count);
+
+    // Вставляет элемент в блок, в котором есть свободное место, на позицию index
+    template <typename... Args>
+    Type* EmplaceInBlock(Block* block, size_t index, Args&&... args);
+
+    // Создаёт пустой блок и вставляет его после prev
+    Block* InsertBlockAfter(BlockBase* prev);
+
+    // Удаляет элементы блока и освобождает его память
+    static void DestroyBlock(Block* block) noexcept;
+
+    // Заполняет пустой список элементами диапазона [first, last), плотно заполняя блоки
+    template <typename It>
+    void MakeList(It first, It last);
+
+    BlockBase head_ = {};
+    size_t size_ = 0;
+};
+
+template <typename Type, size_t BlockCapacity>
+UnrolledSingleLinkedList<Type, BlockCapacity>::UnrolledSingleLinkedList(std::initializer_list<Type> values) {
+    MakeList(values.begin(), values.end());
+}
+
+template <typename Type, size_t BlockCapacity>
+template <typename It, typename>
+UnrolledSingleLinkedList<Type, BlockCapacity>::UnrolledSingleLinkedList(It first, It last) {
+    MakeList(first, last);
+}
+
+template <typename Type, size_t BlockCapacity>
+UnrolledSingleLinkedList<Type, BlockCapacity>::UnrolledSingleLinkedList(const UnrolledSingleLinkedList& other) {
+    MakeList(other.begin(), other.end());
+}
+
+template <typename Type, size_t BlockCapacity>
+UnrolledSingleLinkedList<Type, BlockCapacity>::UnrolledSingleLinkedList(UnrolledSingleLinkedList&& other) noexcept {
+    swap(other);
+}
+
+template <typename Type, size_t BlockCapacity>
+UnrolledSingleLinkedList<Type, BlockCapacity>& UnrolledSingleLinkedList<Type, BlockCapacity>::operator=(
+    const UnrolledSingleLinkedList& rhs) {
+    if (this != &rhs) {
+        auto rhs_copy(rhs);
+        swap(rhs_copy);
+    }
+    return *this;
+}
+
+template <typename Type, size_t BlockCapacity>
+UnrolledSingleLinkedList<Type, BlockCapacity>& UnrolledSingleLinkedList<Type, BlockCapacity>::operator=(
+    UnrolledSingleLinkedList&& rhs) noexcept {
+    if (this != &rhs) {
+        Clear();
+        swap(rhs);
+    }
+    return *this;
+}
+
+template <typename Type, size_t BlockCapacity>
+UnrolledSingleLinkedList<Type, BlockCapacity>::~UnrolledSingleLinkedList() {
+    Clear();
+}
+
+template <typename Type, size_t BlockCapacity>
+void UnrolledSingleLinkedList<Type, BlockCapacity>::swap(UnrolledSingleLinkedList& other) noexcept {
+    std::swap(head_.next_block, other.head_.next_block);
+    std::swap(size_, other.size_);
+}
+
+template <typename Type, size_t BlockCapacity>
+typename UnrolledSingleLinkedList<Type, BlockCapacity>::Iterator UnrolledSingleLinkedList<Type, BlockCapacity>::InsertAfter(
+    ConstIterator pos, const Type& value) {
+    return EmplaceAfter(pos, value);
+}
+
+template <typename Type, size_t BlockCapacity>
+typename UnrolledSingleLinkedList<Type, BlockCapacity>::Iterator UnrolledSingleLinkedList<Type, BlockCapacity>::InsertAfter(
+    ConstIterator pos, Type&& value) {
+    return EmplaceAfter(pos, std::move(value));
+}
+
+template <typename Type, size_t BlockCapacity>
+template <typename... Args>
+typename UnrolledSingleLinkedList<Type, BlockCapacity>::Iterator UnrolledSingleLinkedList<Type, BlockCapacity>::EmplaceAfter(
+    ConstIterator pos, Args&&... args) {
+    assert(pos.block_ != nullptr);
+
+    // Блок и позиция, на которую вставляется элемент
+    Block* block = nullptr;
+    size_t index = 0;
+    if (pos.index_ == BEFORE_BEGIN_INDEX) {
+        block = head_.next_block;
+        if (block == nullptr || block->count == BlockCapacity) {
+            block = InsertBlockAfter(&head_);
+        }
+    } else {
+        block = static_cast<Block*>(pos.block_);
+        index = pos.index_ + 1;
+        if (block->count == BlockCapacity) {
+            if (index == BlockCapacity) {
+                // Вставка после последнего элемента заполненного блока
+                block = InsertBlockAfter(block);
+                index = 0;
+            } else {
+                // Делим заполненный блок пополам. args может ссылаться на элемент переносимой
+                // половины блока, поэтому значение создаётся до деления
+                Type value(std::forward<Args>(args)...);
+                Block* upper = InsertBlockAfter(block);
+                const size_t keep = BlockCapacity / 2;
+                for (size_t i = keep; i < BlockCapacity; ++i) {
+                    block->RelocateTo(i, upper, i - keep);
+                }
+                upper->count = BlockCapacity - keep;
+                block->count = keep;
+                if (index > keep) {
+                    block = upper;
+                    index -= keep;
+                }
+                // После деления оба блока непусты, поэтому при исключении удалять блок не нужно
+                EmplaceInBlock(block, index, std::move(value));
+                ++size_;
+                return Iterator{block, index};
+            }
+        }
+    }
+
+    // Пустой блок, созданный выше, удаляется, если создание элемента завершилось исключением
+    try {
+        EmplaceInBlock(block, index, std::forward<Args>(args)...);
+    } catch (...) {
+        if (block->count == 0) {
+            BlockBase* prev = pos.index_ == BEFORE_BEGIN_INDEX ? &head_ : pos.block_;
+            prev->next_block = block->next_block;
+            DestroyBlock(block);
+        }
+        throw;
+    }
+    ++size_;
+    return Iterator{block, index};
+}
+
+template <typename Type, size_t BlockCapacity>
+typename UnrolledSingleLinkedList<Type, BlockCapacity>::Iterator UnrolledSingleLinkedList<Type, BlockCapacity>::EraseAfter(
+    ConstIterator pos) noexcept {
+    assert(pos.block_ != nullptr);
+    ConstIterator erased = pos;
+    ++erased;
+    assert(erased.block_ != nullptr);
+
+    Block* block = static_cast<Block*>(erased.block_);
+    const size_t index = erased.index_;
+    block->Get(index)->~Type();
+    for (size_t i = index + 1; i < block->count; ++i) {
+        block->RelocateTo(i, block, i - 1);
+    }
+    --block->count;
+    --size_;
+
+    if (block->count == 0) {
+        // Блок опустел. Предыдущий блок - блок pos (либо head_), так как в блоке pos остался элемент
+        assert(erased.block_ != pos.block_);
+        pos.block_->next_block = block->next_block;
+        Block* next = block->next_block;
+        DestroyBlock(block);
+        return Iterator{next, 0};
+    }
+    if (index == block->count) {
+        return Iterator{block->next_block, 0};
+    }
+    return Iterator{block, index};
+}
+
+template <typename Type, size_t BlockCapacity>
+void UnrolledSingleLinkedList<Type, BlockCapacity>::PushFront(const Type& value) {
+    EmplaceFront(value);
+}
+
+template <typename Type, size_t BlockCapacity>
+void UnrolledSingleLinkedList<Type, BlockCapacity>::PushFront(Type&& value) {
+    EmplaceFront(std::move(value));
+}
+
+template <typename Type, size_t BlockCapacity>
+template <typename... Args>
+Type& UnrolledSingleLinkedList<Type, BlockCapacity>::EmplaceFront(Args&&... args) {
+    return *EmplaceAfter(cbefore_begin(), std::forward<Args>(args)...);
+}
+
+template <typename Type, size_t BlockCapacity>
+void UnrolledSingleLinkedList<Type, BlockCapacity>::PopFront() noexcept {
+    assert(size_ > 0);
+    EraseAfter(cbefore_begin());
+}
+
+template <typename Type, size_t BlockCapacity>
+void UnrolledSingleLinkedList<Type, BlockCapacity>::Clear() noexcept {
+    while (head_.next_block) {
+        Block* next = head_.next_block->next_block;
+        DestroyBlock(head_.next_block);
+        head_.next_block = next;
+    }
+    size_ = 0;
+}
+
+template <typename Type, size_t BlockCapacity>
+size_t UnrolledSingleLinkedList<Type, BlockCapacity>::GetSize() const noexcept {
+    return size_;
+}
+
+template <typename Type, size_t BlockCapacity>
+bool UnrolledSingleLinkedList<Type, BlockCapacity>::IsEmpty() const noexcept {
+    return size_ == 0;
+}
+
+template <typename Type, size_t BlockCapacity>
+size_t UnrolledSingleLinkedList<Type, BlockCapacity>::GetBlockCount() const noexcept {
+    size_t count = 0;
+    for (const Block* block = head_.next_block; block != nullptr; block = block->next_block) {
+        ++count;
+    }
+    return count;
+}
+
+template <typename Type, size_t BlockCapacity>
+int UnrolledSingleLinkedList<Type, BlockCapacity>::CompareTo(const UnrolledSingleLinkedList& other) const {
+    return CompareBlocks(other, [](const Type* lhs, const Type* rhs, size_t count) {
+        return CompareSpans(lhs, rhs, count);
+    });
+}
+
+template <typename Type, size_t BlockCapacity>
+bool UnrolledSingleLinkedList<Type, BlockCapacity>::IsEqualTo(const UnrolledSingleLinkedList& other) const {
+    // Списки разной длины не равны, и обходить их не нужно
+    if (size_ != other.size_) {
+        return false;
+    }
+    return CompareBlocks(other, [](const Type* lhs, const Type* rhs, size_t count) {
+        return AreSpansEqual(lhs, rhs, count) ? 0 : 1;
+    }) == 0;
+}
+
+template <typename Type, size_t BlockCapacity>
+template <typename SpanComparator>
+int UnrolledSingleLinkedList<Type, BlockCapacity>::CompareBlocks(const UnrolledSingleLinkedList& other,
+                                                                 SpanComparator compare_spans) const {
+    const Block* lhs = head_.next_block;
+    const Block* rhs = other.head_.next_block;
+    size_t lhs_index = 0;
+    size_t rhs_index = 0;
+    // Пустых блоков в списке нет, поэтому общий участок двух блоков никогда не пуст
+    while (lhs != nullptr && rhs != nullptr) {
+        const size_t count = std::min(lhs->count - lhs_index, rhs->count - rhs_index);
+        const int result = compare_spans(lhs->Get(lhs_index), rhs->Get(rhs_index), count);
+        if (result != 0) {
+            return result;
+        }
+        lhs_index += count;
+        rhs_index += count;
+        if (lhs_index == lhs->count) {
+            lhs = lhs->next_block;
+            lhs_index = 0;
+        }
+        if (rhs_index == rhs->count) {
+            rhs = rhs->next_block;
+            rhs_index = 0;
+        }
+    }
+    if (lhs == nullptr) {
+        return rhs == nullptr ? 0 : -1;
+    }
+    return 1;
+}
+
+template <typename Type, size_t BlockCapacity>
+int UnrolledSingleLinkedList<Type, BlockCapacity>::CompareSpans(const Type* lhs, const Type* rhs, size_t count) {
+    size_t i = 0;
+    if constexpr (std::is_arithmetic_v<Type>) {
+        // Пропускаем пачки равных элементов. Внутри пачки нет условных переходов, и цикл векторизуется.
+        // Пачку с различием (в том числе с NaN) досравниваем поэлементно
+        for (; i + COMPARE_BATCH_SIZE <= count; i += COMPARE_BATCH_SIZE) {
+            bool differs = false;
+            for (size_t j = 0; j < COMPARE_BATCH_SIZE; ++j) {
+                differs |= lhs[i + j] != rhs[i + j];
+            }
+            if (differs) {
+                break;
+            }
+        }
+    }
+    for (; i < count; ++i) {
+        if (lhs[i] < rhs[i]) {
+            return -1;
+        }
+        if (rhs[i] < lhs[i]) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+template <typename Type, size_t BlockCapacity>
+bool UnrolledSingleLinkedList<Type, BlockCapacity>::AreSpansEqual(const Type* lhs, const Type* rhs, size_t count) {
+    if constexpr (std::is_integral_v<Type>) {
+        // Равные целые числа совпадают побайтно, а memcmp использует векторные инструкции
+        return std::memcmp(lhs, rhs, count * sizeof(Type)) == 0;
+    } else if constexpr (std::is_arithmetic_v<Type>) {
+        // Числа с плавающей точкой побайтно сравнивать нельзя: 0.0 == -0.0, а NaN не равен себе
+        size_t i = 0;
+        for (; i + COMPARE_BATCH_SIZE <= count; i += COMPARE_BATCH_SIZE) {
+            bool differs = false;
+            for (size_t j = 0; j < COMPARE_BATCH_SIZE; ++j) {
+                differs |= lhs[i + j] != rhs[i + j];
+            }
+            if (differs) {
+                return false;
+            }
+        }
+        return std::equal(lhs + i, lhs + count, rhs + i);
+    } else {
+        return std::equal(lhs, lhs + count, rhs);
+    }
+}
+
+template <typename Type, size_t BlockCapacity>
+template <typename... Args>
+Type* UnrolledSingleLinkedList<Type, BlockCapacity>::EmplaceInBlock(Block* block, size_t index, Args&&... args) {
+    assert(block->count < BlockCapacity && index <= block->count);
+    if (index == block->count) {
+        Type* item = ::new (block->Slot(index)) Type(std::forward<Args>(args)...);
+        ++block->count;
+        return item;
+    }
+    // Элемент создаётся заранее, чтобы исключение не оставило блок в промежуточном состоянии
+    Type item(std::forward<Args>(args)...);
+    for (size_t i = block->count; i > index; --i) {
+        block->RelocateTo(i - 1, block, i);
+    }
+    ++block->count;
+    return ::new (block->Slot(index)) Type(std::move(item));
+}
+
+template <typename Type, size_t BlockCapacity>
+typename UnrolledSingleLinkedList<Type, BlockCapacity>::Block* UnrolledSingleLinkedList<Type, BlockCapacity>::InsertBlockAfter(
+    BlockBase* prev) {
+    Block* block = new Block;
+    block->next_block = prev->next_block;
+    prev->next_block = block;
+    return block;
+}
+
+template <typename Type, size_t BlockCapacity>
+void UnrolledSingleLinkedList<Type, BlockCapacity>::DestroyBlock(Block* block) noexcept {
+    for (size_t i = 0; i < block->count; ++i) {
+        block->Get(i)->~Type();
+    }
+    delete block;
+}
+
+template <typename Type, size_t BlockCapacity>
+template <typename It>
+void UnrolledSingleLinkedList<Type, BlockCapacity>::MakeList(It first, It last) {
+    assert(head_.next_block == nullptr);
+    BlockBase* tail = &head_;
+    Block* block = nullptr;
+    try {
+        for (; first != last; ++first) {
+            if (block == nullptr || block->count == BlockCapacity) {
+                block = InsertBlockAfter(tail);
+                tail = block;
+            }
+            ::new (block->Slot(block->count)) Type(*first);
+            ++block->count;
+            ++size_;
+        }
+    } catch (...) {
+        Clear();
+        throw;
+    }
+}
+
+template <typename Type, size_t BlockCapacity>
+void swap(UnrolledSingleLinkedList<Type, BlockCapacity>& lhs, UnrolledSingleLinkedList<Type, BlockCapacity>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+template <typename Type, size_t BlockCapacity>
+bool operator==(const UnrolledSingleLinkedList<Type, BlockCapacity>& lhs,
+                const UnrolledSingleLinkedList<Type, BlockCapacity>& rhs) {
+    return lhs.IsEqualTo(rhs);
+}
+
+template <typename Type, size_t BlockCapacity>
+bool operator!=(const UnrolledSingleLinkedList<Type, BlockCapacity>& lhs,
+                const UnrolledSingleLinkedList<Type, BlockCapacity>& rhs) {
+    return !(lhs == rhs);
+}
+
+template <typename Type, size_t BlockCapacity>
+bool operator<(const UnrolledSingleLinkedList<Type, BlockCapacity>& lhs,
+               const UnrolledSingleLinkedList<Type, BlockCapacity>& rhs) {
+    return lhs.CompareTo(rhs) < 0;
+}
+
+template <typename Type, size_t BlockCapacity>
+bool operator>(const UnrolledSingleLinkedList<Type, BlockCapacity>& lhs,
+               const UnrolledSingleLinkedList<Type, BlockCapacity>& rhs) {
+    return lhs.CompareTo(rhs) > 0;
+}
+
+template <typename Type, size_t BlockCapacity>
+bool operator<=(const UnrolledSingleLinkedList<Type, BlockCapacity>& lhs,
+                const UnrolledSingleLinkedList<Type, BlockCapacity>& rhs) {
+    return lhs.CompareTo(rhs) <= 0;
+}
+
+template <typename Type, size_t BlockCapacity>
+bool operator>=(const UnrolledSingleLinkedList<Type, BlockCapacity>& lhs,
+                const UnrolledSingleLinkedList<Type, BlockCapacity>& rhs) {
+    return lhs.CompareTo(rhs) >= 0;
+}
+
+#if __cplusplus > 201703L
+template <typename Type, size_t BlockCapacity>
+std::weak_ordering operator<=>(const UnrolledSingleLinkedList<Type, BlockCapacity>& lhs,
+                                const UnrolledSingleLinkedList<Type, BlockCapacity>& rhs) {
+    const int result = lhs.CompareTo(rhs);
+    if (result < 0) {
+        return std::weak_ordering::less;
+    }
+    return result == 0 ? std::weak_ordering::equivalent : std::weak_ordering::greater;
+}
+#endif